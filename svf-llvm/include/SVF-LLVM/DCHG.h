@@ -358,6 +358,9 @@ public:
     bool isFirstField(const DIType *f, const DIType *b);
 
 protected:
+    /// Virtual functions in slot idx of vtbl, for the compiled resolution index.
+    virtual void getVFnsOfVtbl(const SVFGlobalValue *vtbl, u32_t idx, VFunVector &vfns) override;
+
     /// SVF Module this CHG is built from.
     const SVFModule *svfModule;
     /// Whether this CHG is an extended CHG (first-field). Set by buildCHG.
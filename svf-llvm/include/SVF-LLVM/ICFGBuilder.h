@@ -56,6 +56,9 @@ public:
     }
     void build(SVFModule* svfModule);
 
+    /// Create the ICFG nodes and intra-procedural edges of a single function (used by -lazy-svfir)
+    void buildFunction(const Function* fun);
+
 private:
     /// Create edges between ICFG nodes within a function
     ///@{
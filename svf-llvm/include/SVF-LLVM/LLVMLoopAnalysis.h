@@ -50,9 +50,16 @@ public:
     virtual void buildLLVMLoops(SVFModule *mod, std::vector<const Loop *> &llvmLoops,
                                 llvm::LoopInfoBase<llvm::BasicBlock, llvm::Loop> * loopInfo);
 
+    /// Collect the llvm loops of a single function in pre-order
+    virtual void buildLLVMLoops(const Function *func, std::vector<const Loop *> &llvmLoops,
+                                llvm::LoopInfoBase<llvm::BasicBlock, llvm::Loop> * loopInfo);
+
     /// Start from here
     virtual void build(ICFG *icfg);
 
+    /// Build SVF loops of a single function (used when its ICFG is built lazily)
+    virtual void buildFunction(ICFG *icfg, const Function *func);
+
     /// Build SVF loops based on llvm loops
     virtual void buildSVFLoops(ICFG *icfg, std::vector<const Loop *> &llvmLoops);
 };
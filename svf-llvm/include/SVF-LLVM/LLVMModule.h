@@ -102,6 +102,7 @@ public:
 
     static void releaseLLVMModuleSet()
     {
+        SVFValue::clearSourceLocResolver();
         if (llvmModuleSet)
             delete llvmModuleSet;
         llvmModuleSet = nullptr;
@@ -185,6 +186,9 @@ public:
 
     SVFValue* getSVFValue(const Value* value);
 
+    /// Source code information of an SVFValue, resolved from the LLVM debug info
+    std::string getSourceLoc(const SVFValue* value) const;
+
     const Value* getLLVMValue(const SVFValue* value) const
     {
         SVFValue2LLVMValueMap::const_iterator it = SVFValue2LLVMValue.find(value);
@@ -65,6 +65,12 @@ public:
     /// Start building SVFIR here
     virtual SVFIR* build();
 
+    /// Build the ICFG nodes and SVFStmts of a single function on demand (-lazy-svfir)
+    void buildFunction(const SVFFunction* svffun);
+
+    /// Visit all instructions of a function to create its SVFStmts
+    void visitFunctionBody(const Function& fun);
+
     /// Return SVFIR
     SVFIR* getPAG() const
     {
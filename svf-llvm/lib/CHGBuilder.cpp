@@ -657,7 +657,7 @@ void CHGBuilder::buildCSToCHAVtblsAndVfnsMap()
                     if (vtbls.size() > 0)
                     {
                         CallSite cs = SVFUtil::getSVFCallSite(LLVMModuleSet::getLLVMModuleSet()->getSVFInstruction(callInst));
-                        chg->csToCHAVtblsMap[cs] = vtbls;
+                        chg->csToCHAVtblsMap[cs] = chg->getVTableSetID(vtbls);
                         VFunSet virtualFunctions;
                         chg->getVFnsFromVtbls(cs, vtbls, virtualFunctions);
                         if (virtualFunctions.size() > 0)
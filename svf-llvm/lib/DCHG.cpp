@@ -582,83 +582,26 @@ const VTableSet &DCHGraph::getCSVtblsBasedonCHA(CallSite cs)
 
 void DCHGraph::getVFnsFromVtbls(CallSite cs, const VTableSet &vtbls, VFunSet &virtualFunctions)
 {
-    size_t idx = cs.getFunIdxInVtable();
-    std::string funName = cs.getFunNameOfVirtualCall();
-    for (const SVFGlobalValue *vtbl : vtbls)
+    resolveVFns(cs, vtbls, virtualFunctions);
+}
+
+void DCHGraph::getVFnsOfVtbl(const SVFGlobalValue *vtbl, u32_t idx, VFunVector &vfns)
+{
+    assert(vtblToTypeMap.find(vtbl) != vtblToTypeMap.end() && "floating vtbl");
+    const DIType *type = vtblToTypeMap[vtbl];
+    assert(hasNode(type) && "trying to get vtbl for type not in graph");
+    const DCHNode *node = getNode(type);
+    for (const std::vector<const Function*> &vfnV : node->getVfnVectors())
     {
-        assert(vtblToTypeMap.find(vtbl) != vtblToTypeMap.end() && "floating vtbl");
-        const DIType *type = vtblToTypeMap[vtbl];
-        assert(hasNode(type) && "trying to get vtbl for type not in graph");
-        const DCHNode *node = getNode(type);
-        std::vector<std::vector<const Function* >> allVfns = node->getVfnVectors();
-        for (std::vector<const Function* > vfnV : allVfns)
+        // We only care about any virtual function corresponding to idx.
+        if (idx >= vfnV.size())
         {
-            // We only care about any virtual function corresponding to idx.
-            if (idx >= vfnV.size())
-            {
-                continue;
-            }
-
-            const Function* callee = vfnV[idx];
-            // Practically a copy of that in lib/MemoryModel/CHA.cpp
-            if (cs.arg_size() == callee->arg_size() || (cs.isVarArg() && callee->isVarArg()))
-            {
-                cppUtil::DemangledName dname = cppUtil::demangle(callee->getName().str());
-                std::string calleeName = dname.funcName;
-
-                /*
-                 * The compiler will add some special suffix (e.g.,
-                 * "[abi:cxx11]") to the end of some virtual function:
-                 * In dealII
-                 * function: FE_Q<3>::get_name
-                 * will be mangled as: _ZNK4FE_QILi3EE8get_nameB5cxx11Ev
-                 * after demangling: FE_Q<3>::get_name[abi:cxx11]
-                 * The special suffix ("[abi:cxx11]") needs to be removed
-                 */
-                const std::string suffix("[abi:cxx11]");
-                size_t suffixPos = calleeName.rfind(suffix);
-                if (suffixPos != std::string::npos)
-                {
-                    calleeName.erase(suffixPos, suffix.size());
-                }
+            continue;
+        }
 
-                /*
-                 * if we can't get the function name of a virtual callsite, all virtual
-                 * functions corresponding to idx will be valid
-                 */
-                if (funName.size() == 0)
-                {
-                    virtualFunctions.insert(LLVMUtil::getFunction(callee->getName().str()));
-                }
-                else if (funName[0] == '~')
-                {
-                    /*
-                     * if the virtual callsite is calling a destructor, then all
-                     * destructors in the ch will be valid
-                     * class A { virtual ~A(){} };
-                     * class B: public A { virtual ~B(){} };
-                     * int main() {
-                     *   A *a = new B;
-                     *   delete a;  /// the function name of this virtual callsite is ~A()
-                     * }
-                     */
-                    if (calleeName[0] == '~')
-                    {
-                        virtualFunctions.insert(LLVMUtil::getFunction(callee->getName().str()));
-                    }
-                }
-                else
-                {
-                    /*
-                     * For other virtual function calls, the function name of the callsite
-                     * and the function name of the target callee should match exactly
-                     */
-                    if (funName.compare(calleeName) == 0)
-                    {
-                        virtualFunctions.insert(LLVMUtil::getFunction(callee->getName().str()));
-                    }
-                }
-            }
+        if (const SVFFunction *callee = LLVMUtil::getFunction(vfnV[idx]->getName().str()))
+        {
+            vfns.push_back(callee);
         }
     }
 }
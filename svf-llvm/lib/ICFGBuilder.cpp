@@ -31,6 +31,7 @@
 #include "SVF-LLVM/LLVMUtil.h"
 #include "SVF-LLVM/ICFGBuilder.h"
 #include "SVFIR/SVFIR.h"
+#include "Util/Options.h"
 
 using namespace SVF;
 using namespace SVFUtil;
@@ -45,23 +46,32 @@ void ICFGBuilder::build(SVFModule* svfModule)
     // Add the unqiue global ICFGNode at the entry of a program (before the main method).
     icfg->addGlobalICFGNode();
 
-    for (Module &M : LLVMModuleSet::getLLVMModuleSet()->getLLVMModules())
+    // In lazy mode, function bodies are built on demand via buildFunction
+    if (!Options::LazySVFIR())
     {
-        for (Module::const_iterator F = M.begin(), E = M.end(); F != E; ++F)
+        for (Module &M : LLVMModuleSet::getLLVMModuleSet()->getLLVMModules())
         {
-            const Function *fun = &*F;
-            const SVFFunction* svffun = LLVMModuleSet::getLLVMModuleSet()->getSVFFunction(fun);
-            if (SVFUtil::isExtCall(svffun))
-                continue;
-            WorkList worklist;
-            processFunEntry(fun,worklist);
-            processFunBody(worklist);
-            processFunExit(fun);
+            for (Module::const_iterator F = M.begin(), E = M.end(); F != E; ++F)
+                buildFunction(&*F);
         }
     }
     connectGlobalToProgEntry(svfModule);
 }
 
+/*!
+ * Create ICFG nodes and edges of a function
+ */
+void ICFGBuilder::buildFunction(const Function* fun)
+{
+    const SVFFunction* svffun = LLVMModuleSet::getLLVMModuleSet()->getSVFFunction(fun);
+    if (SVFUtil::isExtCall(svffun))
+        return;
+    WorkList worklist;
+    processFunEntry(fun,worklist);
+    processFunBody(worklist);
+    processFunExit(fun);
+}
+
 /*!
  * function entry
  */
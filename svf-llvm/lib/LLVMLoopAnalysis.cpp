@@ -46,33 +46,43 @@ using namespace SVFUtil;
  */
 void LLVMLoopAnalysis::buildLLVMLoops(SVFModule *mod, std::vector<const Loop *> &llvmLoops, llvm::LoopInfoBase<llvm::BasicBlock, llvm::Loop> * loopInfo)
 {
-    llvm::DominatorTree DT = llvm::DominatorTree();
-    std::vector<const Loop *> loop_stack;
     for (Module& M : LLVMModuleSet::getLLVMModuleSet()->getLLVMModules())
     {
         for (Module::const_iterator F = M.begin(), E = M.end(); F != E; ++F)
         {
-            const Function* func = &*F;
-            const SVFFunction* svffun = LLVMModuleSet::getLLVMModuleSet()->getSVFFunction(func);
-            // do not analyze external call
-            if (SVFUtil::isExtCall(svffun)) continue;
-            DT.recalculate(const_cast<Function&>(*func));
-            loopInfo->analyze(DT);
-            for (const auto &loop: *loopInfo)
-            {
-                loop_stack.push_back(loop);
-            }
-            // pre-order traversal on loop-subloop tree
-            while (!loop_stack.empty())
-            {
-                const Loop *loop = loop_stack.back();
-                loop_stack.pop_back();
-                llvmLoops.push_back(loop);
-                for (const auto &subloop: loop->getSubLoops())
-                {
-                    loop_stack.push_back(subloop);
-                }
-            }
+            buildLLVMLoops(&*F, llvmLoops, loopInfo);
+        }
+    }
+}
+
+/*!
+ * Build llvm loops of a function based on LoopInfo analysis
+ * @param func input function
+ * @param llvmLoops output llvm loops
+ * @param loopInfo llvm LoopInfo
+ */
+void LLVMLoopAnalysis::buildLLVMLoops(const Function *func, std::vector<const Loop *> &llvmLoops, llvm::LoopInfoBase<llvm::BasicBlock, llvm::Loop> * loopInfo)
+{
+    const SVFFunction* svffun = LLVMModuleSet::getLLVMModuleSet()->getSVFFunction(func);
+    // do not analyze external call
+    if (SVFUtil::isExtCall(svffun)) return;
+    llvm::DominatorTree DT = llvm::DominatorTree();
+    std::vector<const Loop *> loop_stack;
+    DT.recalculate(const_cast<Function&>(*func));
+    loopInfo->analyze(DT);
+    for (const auto &loop: *loopInfo)
+    {
+        loop_stack.push_back(loop);
+    }
+    // pre-order traversal on loop-subloop tree
+    while (!loop_stack.empty())
+    {
+        const Loop *loop = loop_stack.back();
+        loop_stack.pop_back();
+        llvmLoops.push_back(loop);
+        for (const auto &subloop: loop->getSubLoops())
+        {
+            loop_stack.push_back(subloop);
         }
     }
 }
@@ -89,6 +99,19 @@ void LLVMLoopAnalysis::build(ICFG *icfg)
     buildSVFLoops(icfg, llvmLoops);
 }
 
+/*!
+ * Build SVF loops of a single function
+ * @param icfg ICFG
+ * @param func function whose ICFG nodes have been built
+ */
+void LLVMLoopAnalysis::buildFunction(ICFG *icfg, const Function *func)
+{
+    std::vector<const Loop *> llvmLoops;
+    llvm::LoopInfoBase<llvm::BasicBlock, llvm::Loop> loopInfo;
+    buildLLVMLoops(func, llvmLoops, &loopInfo);
+    buildSVFLoops(icfg, llvmLoops);
+}
+
 /*!
  * Build SVF loops based on llvm loops
  * @param icfg ICFG
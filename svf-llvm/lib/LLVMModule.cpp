@@ -148,6 +148,12 @@ void LLVMModuleSet::build()
 
     createSVFDataStructure();
     initSVFFunction();
+
+    /// source locations are computed on demand from the debug info
+    SVFValue::setSourceLocResolver([this](const SVFValue* value)
+    {
+        return getSourceLoc(value);
+    });
 }
 
 void LLVMModuleSet::createSVFDataStructure()
@@ -868,8 +874,19 @@ void LLVMModuleSet::setValueAttr(const Value* val, SVFValue* svfvalue)
         svffun->setIsUncalledFunction(LLVMUtil::isUncalledFunction(func));
         svffun->setDefFunForMultipleModule(getSVFFunction(LLVMUtil::getDefFunForMultipleModule(func)));
     }
+}
 
-    svfvalue->setSourceLoc(LLVMUtil::getSourceLoc(val));
+/*!
+ * Compute the source code information of an SVFValue from its debug info.
+ * Installed as SVFValue's resolver so that it only runs for values whose
+ * location is actually requested (e.g., in bug reports).
+ */
+std::string LLVMModuleSet::getSourceLoc(const SVFValue* value) const
+{
+    SVFValue2LLVMValueMap::const_iterator it = SVFValue2LLVMValue.find(value);
+    if (it == SVFValue2LLVMValue.end())
+        return "No source code Info";
+    return LLVMUtil::getSourceLoc(it->second);
 }
 
 SVFConstantData* LLVMModuleSet::getSVFConstantData(const ConstantData* cd)
@@ -122,21 +122,22 @@ SVFIR* SVFIRBuilder::build()
                     pag->addFunArgs(svffun,pag->getGNode(argValNodeId));
                 }
             }
-            for (Function::const_iterator bit = fun.begin(), ebit = fun.end();
-                    bit != ebit; ++bit)
-            {
-                const BasicBlock& bb = *bit;
-                for (BasicBlock::const_iterator it = bb.begin(), eit = bb.end();
-                        it != eit; ++it)
-                {
-                    const Instruction& inst = *it;
-                    setCurrentLocation(&inst,&bb);
-                    visit(const_cast<Instruction&>(inst));
-                }
-            }
+            /// function bodies are visited on demand in lazy mode
+            if (!Options::LazySVFIR())
+                visitFunctionBody(fun);
         }
     }
 
+    if (Options::LazySVFIR())
+    {
+        SVFModule* mod = svfModule;
+        pag->setFunctionMaterializer([mod](const SVFFunction* svffun)
+        {
+            SVFIRBuilder builder(mod);
+            builder.buildFunction(svffun);
+        });
+    }
+
     sanityCheck();
 
     pag->initialiseCandidatePointers();
@@ -155,7 +156,8 @@ SVFIR* SVFIRBuilder::build()
     if (Options::DumpICFG())
         pag->getICFG()->dump("icfg_initial");
 
-    if (Options::LoopAnalysis())
+    /// loops of lazily built functions are analyzed when they are materialized
+    if (Options::LoopAnalysis() && !Options::LazySVFIR())
     {
         LLVMLoopAnalysis loopAnalysis;
         loopAnalysis.build(pag->getICFG());
@@ -167,6 +169,43 @@ SVFIR* SVFIRBuilder::build()
     return pag;
 }
 
+/*!
+ * Build the ICFG nodes and SVFStmts of a function whose body was skipped by a lazy build
+ */
+void SVFIRBuilder::buildFunction(const SVFFunction* svffun)
+{
+    const Function* fun = SVFUtil::cast<Function>(LLVMModuleSet::getLLVMModuleSet()->getLLVMValue(svffun));
+    if (fun->isDeclaration())
+        return;
+    ICFGBuilder icfgbuilder(pag->getICFG());
+    icfgbuilder.buildFunction(fun);
+    visitFunctionBody(*fun);
+    if (Options::LoopAnalysis())
+    {
+        LLVMLoopAnalysis loopAnalysis;
+        loopAnalysis.buildFunction(pag->getICFG(), fun);
+    }
+}
+
+/*!
+ * Visit the instructions of a function
+ */
+void SVFIRBuilder::visitFunctionBody(const Function& fun)
+{
+    for (Function::const_iterator bit = fun.begin(), ebit = fun.end();
+            bit != ebit; ++bit)
+    {
+        const BasicBlock& bb = *bit;
+        for (BasicBlock::const_iterator it = bb.begin(), eit = bb.end();
+                it != eit; ++it)
+        {
+            const Instruction& inst = *it;
+            setCurrentLocation(&inst,&bb);
+            visit(const_cast<Instruction&>(inst));
+        }
+    }
+}
+
 /*
  * Initial all the nodes from symbol table
  */
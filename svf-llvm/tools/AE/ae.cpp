@@ -0,0 +1,60 @@
+//===- ae.cpp -- Abstract execution (interval analysis)-----------------------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013-2017>  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===-----------------------------------------------------------------------===//
+
+/*
+ // Abstract Execution: WTO-based interprocedural interval analysis.
+ //
+ // Author: SVF team,
+ */
+
+#include "SVF-LLVM/LLVMUtil.h"
+#include "SVF-LLVM/SVFIRBuilder.h"
+#include "AbstractExecution/AbstractExecution.h"
+#include "Util/CommandLine.h"
+#include "Util/Options.h"
+
+using namespace llvm;
+using namespace SVF;
+
+int main(int argc, char ** argv)
+{
+
+    char **arg_value = new char*[argc];
+    std::vector<std::string> moduleNameVec;
+    moduleNameVec = OptionBase::parseOptions(
+                        argc, argv, "Abstract Execution (Interval Analysis)", "[options] <input-bitcode...>"
+                    );
+
+    SVFModule* svfModule = LLVMModuleSet::getLLVMModuleSet()->buildSVFModule(moduleNameVec);
+    SVFIRBuilder builder(svfModule);
+    SVFIR* pag = builder.build();
+
+    AbstractExecution ae;
+    ae.runOnModule(pag);
+    ae.printStat();
+
+    SVFIR::releaseSVFIR();
+    LLVMModuleSet::releaseLLVMModuleSet();
+
+    delete[] arg_value;
+    return 0;
+}
@@ -29,6 +29,7 @@
 #include "SVF-LLVM/LLVMUtil.h"
 #include "SVF-LLVM/SVFIRBuilder.h"
 #include "WPA/WPAPass.h"
+#include "WPA/AnalysisServer.h"
 #include "Util/CommandLine.h"
 #include "Util/Options.h"
 
@@ -58,6 +59,13 @@ int main(int argc, char ** argv)
     WPAPass wpa;
     wpa.runOnModule(pag);
 
+    if (!Options::ServerSocket().empty())
+    {
+        AnalysisServer server((BVDataPTAImpl*)wpa.getPTA(), wpa.getSVFG());
+        if (!server.serve(Options::ServerSocket(), Options::ServerThreads()))
+            return 1;
+    }
+
     delete[] arg_value;
     return 0;
 }
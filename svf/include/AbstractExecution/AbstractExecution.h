@@ -0,0 +1,175 @@
+//===- AbstractExecution.h -- WTO-driven abstract interpretation----------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013->  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * AbstractExecution.h
+ *
+ * An interprocedural interval analysis which iterates the basic blocks of
+ * each function in weak topological order (CFBasicBlockGWTO), widening at
+ * cycle heads and narrowing afterwards.
+ *
+ * States are kept sparse: a function only sees its formal parameters, the
+ * abstract memory and the variables it defines itself. The exit state of a
+ * callee is sliced down to memory and its return value, and cached as a
+ * summary keyed by the (sliced) input state so that repeated calls with the
+ * same abstract arguments are not re-analysed.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: SVF team
+ */
+
+#ifndef INCLUDE_ABSTRACTEXECUTION_ABSTRACTEXECUTION_H_
+#define INCLUDE_ABSTRACTEXECUTION_ABSTRACTEXECUTION_H_
+
+#include "AbstractExecution/SVFIR2ItvExeState.h"
+#include "AbstractExecution/WTO.h"
+#include "Graphs/CFBasicBlockG.h"
+
+namespace SVF
+{
+
+class AbstractExecution
+{
+public:
+    typedef Map<const CFBasicBlockNode*, IntervalExeState> BBToStateMap;
+
+    /// Per-function statistics
+    struct FunctionStat
+    {
+        u32_t numOfAnalyses = 0;     ///< number of times the body was analysed
+        u32_t numOfIterations = 0;   ///< number of basic block transfers
+        u32_t numOfWidenings = 0;    ///< number of widenings at cycle heads
+        u32_t numOfNarrowings = 0;   ///< number of narrowings at cycle heads
+        u32_t numOfSummaryHits = 0;  ///< number of calls answered from the summary cache
+        double time = 0;             ///< time spent in this function, excluding callees
+    };
+    typedef OrderedMap<const SVFFunction*, FunctionStat> FunToStatMap;
+
+protected:
+    /// A summary maps a sliced input state to a sliced exit state
+    struct Summary
+    {
+        IntervalExeState input;
+        IntervalExeState output;
+    };
+    typedef Map<u32_t, std::vector<Summary>> HashToSummaries;
+    typedef Map<const SVFFunction*, HashToSummaries> FunToSummariesMap;
+
+    /// The basic block graph and its WTO, built once per function
+    struct FunctionInfo
+    {
+        CFBasicBlockGraph* graph;
+        CFBasicBlockGWTO* wto;
+    };
+    typedef Map<const SVFFunction*, FunctionInfo> FunToInfoMap;
+
+    /// States of the function currently being analysed
+    struct FunctionContext
+    {
+        const SVFFunction* fun;
+        const FunctionInfo* info;
+        IntervalExeState entryES;
+        BBToStateMap postES;
+    };
+
+public:
+    AbstractExecution();
+
+    virtual ~AbstractExecution();
+
+    /// Analyse the whole program starting from main (or every root function if there is no main)
+    virtual void runOnModule(SVFIR* svfir);
+
+    /// Print per-function iteration counts and time
+    void printStat() const;
+
+    inline const FunToStatMap& getFunctionStats() const
+    {
+        return funToStat;
+    }
+
+    /// Exit state (sliced to memory and return value) of the last analysis of a function
+    inline const IntervalExeState* getExitState(const SVFFunction* fun) const
+    {
+        auto it = funToExitES.find(fun);
+        return it == funToExitES.end() ? nullptr : &it->second;
+    }
+
+protected:
+    /// Translate the statements of the global ICFG node and move their values into the global state
+    void initGlobalState();
+
+    /// Analyse fun with the given input state and return its sliced exit state
+    IntervalExeState analyzeFunction(const SVFFunction* fun, const IntervalExeState& input);
+
+    /// Return (and cache) the basic block graph and WTO of fun
+    const FunctionInfo& getFunctionInfo(const SVFFunction* fun);
+
+    /// Fixpoint iteration over WTO components
+    //@{
+    void handleWTOComponent(const CFBasicBlockGWTOComp* comp);
+    void handleCycle(const CFBasicBlockGWTOCycle* cycle);
+    //@}
+
+    /// Join the post states of the feasible predecessors of node, return false if none is reachable
+    bool computePreState(const CFBasicBlockNode* node, IntervalExeState& pre) const;
+
+    /// Whether the control flow from src to dst is feasible under src's post state
+    bool isFeasibleEdge(const CFBasicBlockNode* src, const CFBasicBlockNode* dst, const IntervalExeState& es) const;
+
+    /// Apply the transfer functions of a basic block on its pre state
+    void handleBlock(const CFBasicBlockNode* node, const IntervalExeState& pre);
+
+    void handleICFGNode(const ICFGNode* node);
+
+    void handleCallSite(const CallICFGNode* callNode);
+
+    void handleSVFStmt(const SVFStmt* stmt);
+
+    /// Keep only the given variables and the abstract memory of es
+    IntervalExeState sliceState(const IntervalExeState& es, const Set<NodeID>& vars) const;
+
+    /// Havoc the interval values of all memory locations in es
+    void havocMemory(IntervalExeState& es) const;
+
+    /// Look up / add a summary of fun for the given input
+    //@{
+    const IntervalExeState* getSummary(const SVFFunction* fun, const IntervalExeState& input) const;
+    void addSummary(const SVFFunction* fun, const IntervalExeState& input, const IntervalExeState& output);
+    //@}
+
+protected:
+    SVFIR* svfir;
+    SVFIR2ItvExeState* svfir2ExeState;
+    FunctionContext* curCtx;            ///< context of the function under analysis
+    Set<const SVFFunction*> callStack;  ///< functions under analysis, to cut recursion
+    std::vector<double> calleeTimes;    ///< time spent in callees of each active function
+    FunToInfoMap funToInfo;
+    FunToSummariesMap funToSummaries;
+    FunToStatMap funToStat;
+    Map<const SVFFunction*, IntervalExeState> funToExitES;
+    double totalTime;
+};
+
+} // End namespace SVF
+
+#endif /* INCLUDE_ABSTRACTEXECUTION_ABSTRACTEXECUTION_H_ */
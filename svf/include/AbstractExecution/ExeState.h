@@ -34,6 +34,7 @@
 #include "AbstractExecution/AddressValue.h"
 #include "AbstractExecution/NumericLiteral.h"
 #include "Util/Z3Expr.h"
+#include "Util/PersistentMap.h"
 
 namespace SVF
 {
@@ -50,7 +51,8 @@ class ExeState
 public:
 
     typedef AddressValue VAddrs;
-    typedef Map<u32_t, VAddrs> VarToVAddrs;
+    /// Persistent map: copying a state is O(1) and merges skip shared subtrees
+    typedef PersistentMap<u32_t, VAddrs> VarToVAddrs;
     /// Execution state kind
     enum ExeState_TYPE
     {
@@ -72,7 +74,7 @@ public:
 
     ExeState &operator=(const ExeState &rhs)
     {
-        if(*this != rhs)
+        if (&rhs != this)
         {
             _varToVAddrs = rhs._varToVAddrs;
             _locToVAddrs = rhs._locToVAddrs;
@@ -176,18 +178,10 @@ protected:
 
     static bool eqVarToVAddrs(const VarToVAddrs &lhs, const VarToVAddrs &rhs)
     {
-        if (lhs.size() != rhs.size()) return false;
-        for (const auto &item: lhs)
+        return lhs.equals(rhs, [](const VAddrs &l, const VAddrs &r)
         {
-            auto it = rhs.find(item.first);
-            if (it == rhs.end())
-                return false;
-            if (item.second != it->second)
-            {
-                return false;
-            }
-        }
-        return true;
+            return l == r;
+        });
     }
 
 public:
@@ -42,9 +42,10 @@ namespace SVF
 class IntervalExeState : public ExeState
 {
     friend class SVFIR2ItvExeState;
+    friend class AbstractExecution;
 
 public:
-    typedef Map<u32_t, IntervalValue> VarToValMap;
+    typedef PersistentMap<u32_t, IntervalValue> VarToValMap;
 
     typedef VarToValMap LocToValMap;
 
@@ -76,7 +77,7 @@ public:
     /// check two interval exe state are equal or not. _varToItvVal and _locToItvVal map should be equivalent
     IntervalExeState &operator=(const IntervalExeState &rhs)
     {
-        if (rhs != *this)
+        if (&rhs != this)
         {
             _varToItvVal = rhs._varToItvVal;
             _locToItvVal = rhs._locToItvVal;
@@ -109,10 +110,10 @@ public:
     IntervalExeState bottom()
     {
         IntervalExeState inv = *this;
-        for (auto &item: inv._varToItvVal)
+        inv._varToItvVal.transform([](IntervalValue &val)
         {
-            item.second.set_to_bottom();
-        }
+            val.set_to_bottom();
+        });
         return inv;
     }
 
@@ -120,10 +121,10 @@ public:
     IntervalExeState top()
     {
         IntervalExeState inv = *this;
-        for (auto &item: inv._varToItvVal)
+        inv._varToItvVal.transform([](IntervalValue &val)
         {
-            item.second.set_to_top();
-        }
+            val.set_to_top();
+        });
         return inv;
     }
 
@@ -140,9 +141,8 @@ public:
 
     VAddrs &getVAddrs(u32_t id) override
     {
-        auto it = globalES._varToVAddrs.find(id);
-        if (it != globalES._varToVAddrs.end())
-            return it->second;
+        if (globalES._varToVAddrs.count(id))
+            return globalES._varToVAddrs[id];
         else
             return _varToVAddrs[id];
     }
@@ -201,10 +201,9 @@ public:
     ///  [], call getValueExpr()
     inline IntervalValue &operator[](u32_t varId)
     {
-        auto it = globalES._varToItvVal.find(varId);
-        if (it != globalES._varToItvVal.end())
+        if (globalES._varToItvVal.count(varId))
         {
-            return it->second;
+            return globalES._varToItvVal[varId];
         }
         else
         {
@@ -283,64 +282,36 @@ public:
     {
         assert(isVirtualMemAddress(addr) && "not virtual address?");
         u32_t objId = getInternalID(addr);
-        auto it = _locToItvVal.find(objId);
-        if(it != _locToItvVal.end())
-            return it->second;
+        if (!_locToItvVal.count(objId) && globalES._locToItvVal.count(objId))
+            return globalES._locToItvVal[objId];
         else
-        {
-            auto globIt = globalES._locToItvVal.find(objId);
-            if(globIt != globalES._locToItvVal.end())
-                return globIt->second;
-            else
-                return _locToItvVal[objId];
-        }
+            return _locToItvVal[objId];
     }
 
     inline VAddrs &loadVAddrs(u32_t addr) override
     {
         assert(isVirtualMemAddress(addr) && "not virtual address?");
         u32_t objId = getInternalID(addr);
-        auto it = _locToVAddrs.find(objId);
-        if(it != _locToVAddrs.end())
-            return it->second;
+        if (!_locToVAddrs.count(objId) && globalES._locToVAddrs.count(objId))
+            return globalES._locToVAddrs[objId];
         else
-        {
-            auto globIt = globalES._locToVAddrs.find(objId);
-            if(globIt != globalES._locToVAddrs.end())
-                return globIt->second;
-            else
-                return _locToVAddrs[objId];
-        }
+            return _locToVAddrs[objId];
     }
 
     inline IntervalValue& getLocToItv(u32_t id)
     {
-        auto it = _locToItvVal.find(id);
-        if(it != _locToItvVal.end())
-            return it->second;
+        if (!_locToItvVal.count(id) && globalES._locToItvVal.count(id))
+            return globalES._locToItvVal[id];
         else
-        {
-            auto globIt = globalES._locToItvVal.find(id);
-            if(globIt != globalES._locToItvVal.end())
-                return globIt->second;
-            else
-                return _locToItvVal[id];
-        }
+            return _locToItvVal[id];
     }
 
     inline VAddrs& getLocVAddrs(u32_t id)
     {
-        auto it = _locToVAddrs.find(id);
-        if(it != _locToVAddrs.end())
-            return it->second;
+        if (!_locToVAddrs.count(id) && globalES._locToVAddrs.count(id))
+            return globalES._locToVAddrs[id];
         else
-        {
-            auto globIt = globalES._locToVAddrs.find(id);
-            if(globIt != globalES._locToVAddrs.end())
-                return globIt->second;
-            else
-                return _locToVAddrs[id];
-        }
+            return _locToVAddrs[id];
     }
 
     /// Print values of all expressions
@@ -353,18 +324,10 @@ public:
 
     static bool eqVarToValMap(const VarToValMap &lhs, const VarToValMap &rhs)
     {
-        if (lhs.size() != rhs.size()) return false;
-        for (const auto &item: lhs)
+        return lhs.equals(rhs, [](const IntervalValue &l, const IntervalValue &r)
         {
-            auto it = rhs.find(item.first);
-            if (it == rhs.end())
-                return false;
-            if (!item.second.equals(it->second))
-            {
-                return false;
-            }
-        }
-        return true;
+            return l.equals(r);
+        });
     }
 
 
@@ -509,7 +509,7 @@ public:
 
     CFBasicBlockGWTO &operator=(CFBasicBlockGWTO &&other) = default;
 
-    ~CFBasicBlockGWTO()
+    virtual ~CFBasicBlockGWTO()
     {
         for (const auto &component: _allComponents)
         {
@@ -67,6 +67,12 @@ public:
     /// Build CFLGraph based on Option
     virtual void buildCFLGraph();
 
+    /// Load CFLGraph from the -cflgraph file
+    CFLGraph* loadCFLGraph(CFLGraphBuilder& cflGraphBuilder);
+
+    /// Write CFLGraph as a binary edge list if -write-cflgraph is set
+    void writeCFLGraph(CFLGraphBuilder& cflGraphBuilder);
+
     /// Normalize grammar
     virtual void normalizeCFLGrammar();
 
@@ -82,6 +88,9 @@ public:
     /// Finalize extra stat info passing
     virtual void finalize();
 
+    /// Collect statistics from the solver
+    void collectSolverStat();
+
     /// Perform analyze (main part of CFLR Analysis)
     virtual void analyze();
 
@@ -92,6 +101,8 @@ public:
     static double timeOfNormalizeGrammar;           // Time of normalizing grammarBase to CFLGrammar
     // Graph
     static double timeOfBuildCFLGraph;              // Time of building CFLGraph
+    static double numOfLoadedEdges;                 // Number of edges loaded from a -cflgraph file
+    static double timeOfLoadingCFLGraph;            // Wall-clock time of loading a -cflgraph file, in seconds
     static double numOfTerminalEdges;               // Number of terminal labeled edges
     static double numOfTemporaryNonterminalEdges;   // Number of temporary (ie. X0, X1..) nonterminal labeled edges
     static double numOfNonterminalEdges;            // Number of nonterminal labeled edges
@@ -100,6 +111,11 @@ public:
     static double numOfIteration;                   // Number solving Iteration
     static double numOfChecks;                  // Number of checks
     static double timeOfSolving;                    // time of solving CFL Reachability
+    static double numOfThreads;                     // Number of solver threads
+    static double numOfRounds;                      // Number of parallel solving rounds
+    static double timeOfWallSolving;                // Wall-clock time of solving, in seconds
+    static double timeOfWorkerBusy;                 // Busy time summed over parallel workers, in seconds
+    static double timeOfDeriving;                   // Wall-clock time of parallel derivation, in seconds
     //@}
 
 protected:
@@ -33,13 +33,26 @@
 #include "CFL/CFLGrammar.h"
 #include "Graphs/CFLGraph.h"
 #include "Graphs/SVFG.h"
+#include "Util/MappedFile.h"
 
 namespace SVF
 {
 
 /*!
- * Build CFLGraph from memory graph or dot form
-
+ * Build CFLGraph from memory graph, dot form or binary edge list form
+ *
+ * Dot Format:
+ *      Node<hex id> -> Node<hex id> [... label=<label>]
+ *      one edge per line, other lines are ignored
+ *
+ * Binary Edge List Format (native byte order):
+ *      char[8] magic "SVFCFLG1"
+ *      u32 numLabels, then per label: u32 length, chars
+ *      u64 numNodes, then u32 node id per node
+ *      u64 numEdges, then per edge: u32 src, u32 dst, u32 label index, u32 attribute
+ *
+ * Both formats are memory-mapped and decoded in parallel chunks
+ * (-cfl-threads), and the graph is then constructed in bulk.
  */
 
 class CFLGraphBuilder
@@ -53,7 +66,41 @@ protected:
     bool externMap;
     Kind current;
 
+    /// An edge decoded from an input file, its label is an index into a label table
+    struct LoadedEdge
+    {
+        NodeID src;
+        NodeID dst;
+        u32_t label;
+        u32_t attribute;
+    };
+
+    /// Loading statistics
+    //@{
+    u64_t numOfLoadedEdges;
+    double timeOfLoading;
+    //@}
+
+    /// Copy terminals and nonterminals of grammar into the label/kind maps
+    void loadGrammarLabels(GrammarBase *grammar);
+
+    /// Map a label read from an input file to its kind, adding it if -flex-symmap is set
+    Kind resolveLabel(const std::string& label, u64_t lineNum);
+
+    /// Create the nodes and edges of loaded edges in bulk
+    void bulkBuild(CFLGraph* cflGraph, const std::vector<std::vector<LoadedEdge>>& edgeChunks,
+                   const std::vector<std::vector<Kind>>& labelKinds);
+
+    /// Build graph from a mapped file in binary edge list form
+    CFLGraph *buildFromBinary(const MappedFile& file, GrammarBase *grammar);
+
 public:
+    CFLGraphBuilder() : externMap(false), current(0), numOfLoadedEdges(0), timeOfLoading(0)
+    {
+    }
+
+    /// Magic bytes of the binary edge list format
+    static const char binaryMagic[8];
     /// add attribute to kind2Attribute Map
     void addAttribute(CFLGrammar::Kind kind, CFLGrammar::Attribute attribute);
 
@@ -127,9 +174,24 @@ public:
     /// Build graph from file
     void build(std::string filename, CFLGraph* cflGraph);
 
-    /// Build graph from Dot
+    /// Build graph from Dot (or binary edge list, detected by its magic bytes)
     CFLGraph *buildFromDot(std::string filename, GrammarBase *grammar);
 
+    /// Write cflGraph in binary edge list form
+    void writeBinary(CFLGraph* cflGraph, std::string fileName);
+
+    /// Number of edges and time (wall-clock seconds) of the last load from file
+    //@{
+    inline u64_t getNumOfLoadedEdges() const
+    {
+        return numOfLoadedEdges;
+    }
+    inline double getTimeOfLoading() const
+    {
+        return timeOfLoading;
+    }
+    //@}
+
     Map<std::string, Kind>& getLabel2KindMap()
     {
         return this->label2KindMap;
@@ -155,9 +155,30 @@ public:
     typedef CFLGrammar::Production Production;
     typedef CFLGrammar::Symbol Symbol;
 
+    /// An edge X(src,dst) derived during a parallel round but not yet added to the graph
+    struct DerivedEdge
+    {
+        NodeID src;
+        NodeID dst;
+        Symbol label;
+
+        DerivedEdge(NodeID s, NodeID d, Symbol l) : src(s), dst(d), label(l)
+        {
+        }
+    };
+    typedef std::vector<DerivedEdge> DerivedEdges;
+
     static double numOfChecks;
 
-    CFLSolver(CFLGraph* _graph, CFLGrammar* _grammar): graph(_graph), grammar(_grammar)
+    /// Parallel solving statistics
+    //@{
+    static double numOfRounds;          // Number of bulk-synchronous rounds
+    static double timeOfWallSolving;    // Wall-clock time spent in solve(), in seconds
+    static double timeOfWorkerBusy;     // Wall-clock time summed over all workers while deriving, in seconds
+    static double timeOfDeriving;       // Wall-clock time of the (parallel) derivation phases, in seconds
+    //@}
+
+    CFLSolver(CFLGraph* _graph, CFLGrammar* _grammar): graph(_graph), grammar(_grammar), numOfThreads(1)
     {
     }
 
@@ -176,6 +197,18 @@ public:
     /// Start solving
     virtual void solve();
 
+    /// Number of worker threads used by solve(); 1 selects the serial worklist algorithm
+    //@{
+    inline void setNumOfThreads(u32_t n)
+    {
+        numOfThreads = n == 0 ? 1 : n;
+    }
+    inline u32_t getNumOfThreads() const
+    {
+        return numOfThreads;
+    }
+    //@}
+
     /// Return CFL Graph
     inline const CFLGraph* getGraph() const
     {
@@ -210,11 +243,30 @@ protected:
     }
     //@}
 
+    /// Parallel solving
+    /// The worklist is drained into a frontier each round. Worker threads derive
+    /// new edges from the frontier against the (read-only) graph, deduplicated
+    /// through a node-partitioned concurrent edge set. The derived edges are then
+    /// committed into the graph and form the next frontier. Since every committed
+    /// edge is eventually processed against all edges present in the graph, the
+    /// fixpoint is the same as that of the serial worklist algorithm.
+    //@{
+    virtual void solveInParallel();
+
+    /// Derive the edges produced by Y_edge without modifying the graph (thread-safe)
+    virtual void deriveCFLEdges(const CFLEdge* Y_edge, DerivedEdges& derived, double& checks);
+
+    /// Add a derived edge into the graph, returning it if it is new
+    virtual const CFLEdge* commitCFLEdge(const DerivedEdge& edge);
+    //@}
+
 protected:
     CFLGraph* graph;
     CFLGrammar* grammar;
     /// Worklist for resolution
     WorkList worklist;
+    /// Number of worker threads
+    u32_t numOfThreads;
 
 };
 
@@ -350,6 +402,31 @@ public:
         return newSrcs;
     }
 
+    /// Lookup-only variants which never insert, safe for concurrent readers
+    //@{
+    inline const NodeBS& findSuccs(const NodeID key, const Label ty) const
+    {
+        const_iterator iter1 = succMap.find(key);
+        if (iter1 == succMap.end())
+            return emptyData;
+        auto iter2 = iter1->second.find(ty);
+        if (iter2 == iter1->second.end())
+            return emptyData;
+        return iter2->second;
+    }
+
+    inline const NodeBS& findPreds(const NodeID key, const Label ty) const
+    {
+        const_iterator iter1 = predMap.find(key);
+        if (iter1 == predMap.end())
+            return emptyData;
+        auto iter2 = iter1->second.find(ty);
+        if (iter2 == iter1->second.end())
+            return emptyData;
+        return iter2->second;
+    }
+    //@}
+
     /// find src -> find src[ty] -> find dst in set
     inline bool hasEdge(const NodeID src, const NodeID dst, const Label ty)
     {
@@ -388,6 +465,14 @@ public:
     virtual void buildCFLData();
 
     virtual void initialize();
+
+protected:
+    /// Parallel solving over CFLData
+    //@{
+    virtual void deriveCFLEdges(const CFLEdge* Y_edge, DerivedEdges& derived, double& checks);
+
+    virtual const CFLEdge* commitCFLEdge(const DerivedEdge& edge);
+    //@}
 };
 }
 
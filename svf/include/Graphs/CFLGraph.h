@@ -89,6 +89,7 @@ public:
 private:
     CFLEdgeDataTy inCFLEdges;
     CFLEdgeDataTy outCFLEdges;
+    static const CFLEdge::CFLEdgeSetTy emptyCFLEdgeSet;
 
 public:
     inline const CFLEdge::CFLEdgeSetTy& getInEdgeWithTy(GrammarBase::Symbol s)
@@ -101,6 +102,21 @@ public:
         return outCFLEdges[s];
     }
 
+    /// Lookup-only variants which never insert, safe for concurrent readers
+    //@{
+    inline const CFLEdge::CFLEdgeSetTy& getInEdgeWithTy(GrammarBase::Symbol s) const
+    {
+        auto it = inCFLEdges.find(s);
+        return it == inCFLEdges.end() ? emptyCFLEdgeSet : it->second;
+    }
+
+    inline const CFLEdge::CFLEdgeSetTy& getOutEdgeWithTy(GrammarBase::Symbol s) const
+    {
+        auto it = outCFLEdges.find(s);
+        return it == outCFLEdges.end() ? emptyCFLEdgeSet : it->second;
+    }
+    //@}
+
     inline bool addInEdgeWithKind(CFLEdge* inEdge, GrammarBase::Symbol s)
     {
         assert(inEdge->getDstID() == this->getId());
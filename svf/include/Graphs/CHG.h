@@ -68,8 +68,53 @@ public:
         return kind;
     }
 
+    /// Compiled virtual-call resolution index
+    //@{
+    typedef u32_t VTableSetID;
+    typedef std::vector<const SVFFunction*> VFunVector;
+
+    /// Hash-conses vtbls: equal vtable sets get the same ID.
+    VTableSetID getVTableSetID(const VTableSet &vtbls);
+    inline const VTableSet &getVTableSet(VTableSetID id) const
+    {
+        assert(id < vtblSets.size() && "unknown vtable set ID");
+        return vtblSets[id];
+    }
+    /// Functions in slot idx of the vtables of set id, computed once per (id, idx).
+    const VFunVector &getVFnsAtIdx(VTableSetID id, u32_t idx);
+    //@}
+
 protected:
     CHGKind kind;
+
+    /// Appends the functions in slot idx of vtbl (over all its sub-vtables) to vfns.
+    virtual void getVFnsOfVtbl(const SVFGlobalValue *vtbl, u32_t idx, VFunVector &vfns) = 0;
+
+    /// Graph-specific check of callee against the signature of the virtual callsite cs.
+    virtual bool matchesVCallSignature(CallSite, const SVFFunction*)
+    {
+        return true;
+    }
+
+    /// Resolves cs on vtbls through the compiled index; the result for each
+    /// (cs, vtable set) pair is memoised.
+    void resolveVFns(CallSite cs, const VTableSet &vtbls, VFunSet &virtualFunctions);
+
+private:
+    /// Demangled function name of fn (without the "[abi:cxx11]" suffix) to match against callsites.
+    const std::string &getVFnMatchName(const SVFFunction *fn);
+
+    /// Whether the virtual callsite cs may call callee.
+    bool isVCallTarget(CallSite cs, const std::string &funName, const SVFFunction *callee);
+
+    /// Dense IDs of vtables, used to key vtable sets as bitsets.
+    Map<const SVFGlobalValue*, NodeID> vtblToID;
+    Map<NodeBS, VTableSetID> vtblSetToID;
+    /// A deque keeps references returned by getVTableSet valid.
+    std::deque<VTableSet> vtblSets;
+    Map<std::pair<VTableSetID, u32_t>, VFunVector> vfnsAtIdx;
+    Map<const SVFFunction*, std::string> vfnMatchNames;
+    Map<std::pair<const SVFInstruction*, VTableSetID>, VFunSet> resolvedVFns;
 };
 
 
@@ -214,7 +259,7 @@ public:
     typedef FIFOWorkList<const CHNode*> WorkList;
     typedef Map<std::string, CHNodeSetTy> NameToCHNodesMap;
     typedef Map<CallSite, CHNodeSetTy> CallSiteToCHNodesMap;
-    typedef Map<CallSite, VTableSet> CallSiteToVTableSetMap;
+    typedef Map<CallSite, VTableSetID> CallSiteToVTableSetMap;
     typedef Map<CallSite, VFunSet> CallSiteToVFunSetMap;
 
     typedef enum
@@ -291,7 +336,7 @@ public:
     {
         CallSiteToVTableSetMap::const_iterator it = csToCHAVtblsMap.find(cs);
         assert(it != csToCHAVtblsMap.end() && "cs does not have vtabls based on CHA.");
-        return it->second;
+        return getVTableSet(it->second);
     }
     inline const VFunSet &getCSVFsBasedonCHA(CallSite cs) override
     {
@@ -305,6 +350,10 @@ public:
         return chg->getKind() == Standard;
     }
 
+protected:
+    void getVFnsOfVtbl(const SVFGlobalValue *vtbl, u32_t idx, VFunVector &vfns) override;
+    bool matchesVCallSignature(CallSite cs, const SVFFunction* callee) override;
+
 
 private:
     SVFModule* svfMod;
@@ -319,6 +368,7 @@ private:
     CallSiteToCHNodesMap csToClassesMap;
 
     Map<const SVFFunction*, u32_t> virtualFunctionToIDMap;
+    /// CHA vtable sets of callsites, hash-consed (callsites on the same class share one set)
     CallSiteToVTableSetMap csToCHAVtblsMap;
     CallSiteToVFunSetMap csToCHAVFnsMap;
 };
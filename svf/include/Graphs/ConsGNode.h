@@ -45,6 +45,15 @@ public:
     typedef ConstraintEdge::ConstraintEdgeSetTy::const_iterator const_iterator;
     bool _isPWCNode;
 
+    /// An edge as seen by the solver's propagation loops: the node at the
+    /// other end (dst of an outgoing edge, src of an incoming one) and the edge.
+    struct EdgeRecord
+    {
+        NodeID node;
+        ConstraintEdge* edge;
+    };
+    typedef std::vector<EdgeRecord> EdgeRecordVec;
+
 private:
     ConstraintEdge::ConstraintEdgeSetTy loadInEdges; ///< all incoming load edge of this node
     ConstraintEdge::ConstraintEdgeSetTy loadOutEdges; ///< all outgoing load edge of this node
@@ -66,12 +75,34 @@ private:
     ConstraintEdge::ConstraintEdgeSetTy addressInEdges; ///< all incoming address edge of this node
     ConstraintEdge::ConstraintEdgeSetTy addressOutEdges; ///< all outgoing address edge of this node
 
+    /// Contiguous copies of the edge sets walked on every propagation, in set
+    /// order. A copy is rebuilt on its next read after its set has changed.
+    //@{
+    mutable EdgeRecordVec copyOutRecords;
+    mutable EdgeRecordVec gepOutRecords;
+    mutable EdgeRecordVec loadOutRecords;
+    mutable EdgeRecordVec storeInRecords;
+    mutable bool copyOutStale;
+    mutable bool gepOutStale;
+    mutable bool loadOutStale;
+    mutable bool storeInStale;
+    //@}
+
+    static inline void buildRecords(const ConstraintEdge::ConstraintEdgeSetTy& edges, EdgeRecordVec& records, bool outgoing)
+    {
+        records.clear();
+        records.reserve(edges.size());
+        for (ConstraintEdge* edge : edges)
+            records.push_back({outgoing ? edge->getDstID() : edge->getSrcID(), edge});
+    }
+
 public:
     /// For stride-based field representation
     NodeBS strides;
     NodeBS baseIds;
 
-    ConstraintNode(NodeID i) : GenericConsNodeTy(i, 0), _isPWCNode(false)
+    ConstraintNode(NodeID i) : GenericConsNodeTy(i, 0), _isPWCNode(false),
+        copyOutStale(false), gepOutStale(false), loadOutStale(false), storeInStale(false)
     {
 
     }
@@ -150,6 +181,47 @@ public:
     }
     //@}
 
+    /// Return the edges walked by the solver as contiguous records. The
+    /// records are invalidated when edges of the same kind are added or removed.
+    //@{
+    inline const EdgeRecordVec& getCopyOutRecords() const
+    {
+        if (copyOutStale)
+        {
+            buildRecords(copyOutEdges, copyOutRecords, true);
+            copyOutStale = false;
+        }
+        return copyOutRecords;
+    }
+    inline const EdgeRecordVec& getGepOutRecords() const
+    {
+        if (gepOutStale)
+        {
+            buildRecords(gepOutEdges, gepOutRecords, true);
+            gepOutStale = false;
+        }
+        return gepOutRecords;
+    }
+    inline const EdgeRecordVec& getLoadOutRecords() const
+    {
+        if (loadOutStale)
+        {
+            buildRecords(loadOutEdges, loadOutRecords, true);
+            loadOutStale = false;
+        }
+        return loadOutRecords;
+    }
+    inline const EdgeRecordVec& getStoreInRecords() const
+    {
+        if (storeInStale)
+        {
+            buildRecords(storeInEdges, storeInRecords, false);
+            storeInStale = false;
+        }
+        return storeInRecords;
+    }
+    //@}
+
     ///  Iterators
     //@{
     iterator directOutEdgeBegin();
@@ -238,11 +310,13 @@ public:
     {
         addOutgoingDirectEdge(outEdge);
         copyOutEdges.insert(outEdge);
+        copyOutStale = true;
     }
     inline void addOutgoingGepEdge(GepCGEdge* outEdge)
     {
         addOutgoingDirectEdge(outEdge);
         gepOutEdges.insert(outEdge);
+        gepOutStale = true;
     }
     inline void addIncomingAddrEdge(AddrCGEdge* inEdge)
     {
@@ -257,6 +331,7 @@ public:
     inline void addIncomingStoreEdge(StoreCGEdge* inEdge)
     {
         storeInEdges.insert(inEdge);
+        storeInStale = true;
         addIncomingEdge(inEdge);
     }
     inline bool addIncomingDirectEdge(ConstraintEdge* inEdge)
@@ -276,6 +351,7 @@ public:
     inline bool addOutgoingLoadEdge(LoadCGEdge* outEdge)
     {
         bool added1 = loadOutEdges.insert(outEdge).second;
+        loadOutStale = true;
         bool added2 = addOutgoingEdge(outEdge);
         bool both_added = added1 & added2;
         assert(both_added && "edge not added, duplicated adding!!");
@@ -323,9 +399,15 @@ public:
     inline bool removeOutgoingDirectEdge(ConstraintEdge* outEdge)
     {
         if (SVFUtil::isa<GepCGEdge>(outEdge))
+        {
             gepOutEdges.erase(outEdge);
+            gepOutStale = true;
+        }
         else
+        {
             copyOutEdges.erase(outEdge);
+            copyOutStale = true;
+        }
         u32_t num1 = directOutEdges.erase(outEdge);
         u32_t num2 = removeOutgoingEdge(outEdge);
         bool removed = (num1 > 0) & (num2 > 0);
@@ -349,6 +431,7 @@ public:
     inline bool removeOutgoingLoadEdge(LoadCGEdge* outEdge)
     {
         u32_t num1 = loadOutEdges.erase(outEdge);
+        loadOutStale = true;
         u32_t num2 = removeOutgoingEdge(outEdge);
         bool removed = (num1 > 0) & (num2 > 0);
         assert(removed && "edge not in the set, can not remove!!!");
@@ -376,6 +459,7 @@ public:
     inline bool removeIncomingStoreEdge(StoreCGEdge* inEdge)
     {
         u32_t num1 = storeInEdges.erase(inEdge);
+        storeInStale = true;
         u32_t num2 = removeIncomingEdge(inEdge);
         bool removed = (num1 > 0) & (num2 > 0);
         assert(removed && "edge not in the set, can not remove!!!");
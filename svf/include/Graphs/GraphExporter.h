@@ -0,0 +1,425 @@
+//===- GraphExporter.h -- Stream a graph to binary/GraphML/CSV files-----------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013-2017>  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+
+/*
+ * GraphExporter.h
+ *
+ * Export of large graphs for other tools. Unlike GraphWriter, which builds one
+ * DOT record per node, nodes are rendered in fixed-size chunks (in parallel
+ * with several threads) and each chunk is appended to the output as soon as
+ * it is ready, so memory stays bounded by threads * chunk size.
+ *
+ * Formats:
+ *  - BINARY:  GraphName.bin, a compact edge list (host byte order):
+ *               char[8] "SVFGRAPH", u32 version (1), u32 flags
+ *               (bit 0: node kinds, bit 1: edge kinds),
+ *               u64 #nodes, then per node: u32 id [, u32 kind],
+ *               u64 #edges, then per edge: u32 src, u32 dst [, u32 kind].
+ *             Labels and attributes are not stored.
+ *  - GRAPHML: GraphName.graphml.
+ *  - CSV:     GraphName.nodes.csv and GraphName.edges.csv, with a header row,
+ *             ready for bulk import into graph databases.
+ *
+ * Columns besides node IDs and edge endpoints are chosen with a comma-separated
+ * list of "kind" (node/edge kind), "label" (the DOT node label) and "attrs"
+ * (the DOT node/edge attributes). Labels are the expensive column.
+ */
+
+#ifndef INCLUDE_GRAPHS_GRAPHEXPORTER_H_
+#define INCLUDE_GRAPHS_GRAPHEXPORTER_H_
+
+#include "Util/SVFUtil.h"
+#include "Graphs/GraphPrinter.h"
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <thread>
+
+namespace SVF
+{
+
+namespace GraphFormat
+{
+
+enum Name
+{
+    DOT,
+    BINARY,
+    GRAPHML,
+    CSV
+};
+
+} // end namespace GraphFormat
+
+template<typename GraphType>
+class GraphExporter
+{
+    using DOTTraits = DOTGraphTraits<GraphType>;
+    using GTraits = GenericGraphTraits<GraphType>;
+    using NodeRef = typename GTraits::NodeRef;
+    using child_iterator = typename GTraits::ChildIteratorType;
+
+    /// Renders one node (or its out-edges) into a chunk buffer, returning the number of records.
+    typedef std::function<u32_t(DOTTraits&, NodeRef, std::string&)> Renderer;
+
+    /// Number of nodes rendered by one thread before its output is written.
+    static const size_t chunkSize = 4096;
+
+public:
+    GraphExporter(const GraphType &g, bool simple, const std::string &columns, u32_t numThreads)
+        : G(g), simple(simple), threads(numThreads == 0 ? 1 : numThreads),
+          kindColumn(false), labelColumn(false), attrsColumn(false)
+    {
+        for (const std::string &column : SVFUtil::split(columns, ','))
+        {
+            if (column == "kind") kindColumn = true;
+            else if (column == "label") labelColumn = true;
+            else if (column == "attrs") attrsColumn = true;
+            else if (!column.empty()) SVFUtil::writeWrnMsg("unknown graph export column '" + column + "' ignored");
+        }
+
+        DOTTraits traits(simple);
+        for (const auto node : nodes<GraphType>(G))
+        {
+            if (!traits.isNodeHidden(node, G))
+                visibleNodes.push_back(node);
+        }
+    }
+
+    /// Writes the graph into GraphName plus the extension(s) of format.
+    void exportGraph(OutStream &O, const std::string &GraphName, GraphFormat::Name format)
+    {
+        switch (format)
+        {
+        case GraphFormat::BINARY:
+            writeBinary(O, GraphName + ".bin");
+            break;
+        case GraphFormat::GRAPHML:
+            writeGraphML(O, GraphName + ".graphml");
+            break;
+        case GraphFormat::CSV:
+            writeCSV(O, GraphName + ".nodes.csv", GraphName + ".edges.csv");
+            break;
+        default:
+            assert(false && "GraphExporter: DOT is written by GraphWriter!");
+        }
+    }
+
+private:
+    const GraphType &G;
+    bool simple;
+    u32_t threads;
+    bool kindColumn;
+    bool labelColumn;
+    bool attrsColumn;
+    std::vector<NodeRef> visibleNodes;
+
+    /// Appends render's output for every visible node to out, chunk by chunk and
+    /// in node order. Returns the total number of records rendered.
+    u64_t streamNodes(std::ofstream &out, const Renderer &render) const
+    {
+        u64_t records = 0;
+        std::vector<std::string> buffers(threads);
+        std::vector<u32_t> counts(threads);
+        for (size_t begin = 0; begin < visibleNodes.size(); begin += chunkSize * threads)
+        {
+            auto worker = [this, begin, &render, &buffers, &counts](const u32_t thread)
+            {
+                DOTTraits traits(simple);
+                buffers[thread].clear();
+                counts[thread] = 0;
+                const size_t chunkBegin = std::min(begin + thread * chunkSize, visibleNodes.size());
+                const size_t chunkEnd = std::min(chunkBegin + chunkSize, visibleNodes.size());
+                for (size_t i = chunkBegin; i < chunkEnd; ++i)
+                    counts[thread] += render(traits, visibleNodes[i], buffers[thread]);
+            };
+
+            if (threads == 1)
+            {
+                worker(0);
+            }
+            else
+            {
+                std::vector<std::thread> workers;
+                for (u32_t i = 0; i < threads; ++i)
+                    workers.push_back(std::thread(worker, i));
+                for (std::thread &t : workers)
+                    t.join();
+            }
+
+            for (u32_t i = 0; i < threads; ++i)
+            {
+                out.write(buffers[i].data(), buffers[i].size());
+                records += counts[i];
+            }
+        }
+
+        return records;
+    }
+
+    bool isEdgeVisible(DOTTraits &traits, child_iterator EI) const
+    {
+        NodeRef target = *EI;
+        return target != nullptr && !traits.isNodeHidden(target, G);
+    }
+
+    static inline u32_t getEdgeKind(child_iterator EI)
+    {
+        return (*EI.getCurrent())->getEdgeKind();
+    }
+
+    static inline void appendU32(std::string &buffer, u32_t value)
+    {
+        char bytes[sizeof(u32_t)];
+        std::memcpy(bytes, &value, sizeof(u32_t));
+        buffer.append(bytes, sizeof(u32_t));
+    }
+
+    static inline void writeU64(std::ofstream &out, u64_t value)
+    {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(u64_t));
+    }
+
+    static std::string escapeXML(const std::string &str)
+    {
+        std::string escaped;
+        escaped.reserve(str.size());
+        for (const char c : str)
+        {
+            switch (c)
+            {
+            case '&':
+                escaped += "&amp;";
+                break;
+            case '<':
+                escaped += "&lt;";
+                break;
+            case '>':
+                escaped += "&gt;";
+                break;
+            case '"':
+                escaped += "&quot;";
+                break;
+            default:
+                escaped += c;
+            }
+        }
+        return escaped;
+    }
+
+    /// Quotes a CSV field (RFC 4180) when it contains a separator, quote or line break.
+    static std::string escapeCSV(const std::string &str)
+    {
+        if (str.find_first_of(",\"\n\r") == std::string::npos)
+            return str;
+
+        std::string escaped = "\"";
+        for (const char c : str)
+        {
+            if (c == '"') escaped += '"';
+            escaped += c;
+        }
+        return escaped + "\"";
+    }
+
+    bool openFile(OutStream &O, std::ofstream &out, const std::string &filename, bool binary = false) const
+    {
+        out.open(filename, binary ? std::ios::out | std::ios::binary : std::ios::out);
+        if (out.fail())
+        {
+            O << "  error opening file for writing!\n";
+            return false;
+        }
+
+        O << "Writing '" << filename << "'...";
+        return true;
+    }
+
+    void writeBinary(OutStream &O, const std::string &filename) const
+    {
+        std::ofstream out;
+        if (!openFile(O, out, filename, true))
+            return;
+
+        const u32_t version = 1;
+        const u32_t flags = kindColumn ? 0x3 : 0x0;
+        out.write("SVFGRAPH", 8);
+        out.write(reinterpret_cast<const char*>(&version), sizeof(u32_t));
+        out.write(reinterpret_cast<const char*>(&flags), sizeof(u32_t));
+
+        writeU64(out, visibleNodes.size());
+        streamNodes(out, [this](DOTTraits &, NodeRef node, std::string &buffer)
+        {
+            appendU32(buffer, GTraits::getNodeID(node));
+            if (kindColumn) appendU32(buffer, node->getNodeKind());
+            return 1;
+        });
+
+        // The edge count is only known once every node has been rendered.
+        const std::streampos edgeCountPos = out.tellp();
+        writeU64(out, 0);
+        const u64_t numEdges = streamNodes(out, [this](DOTTraits &traits, NodeRef node, std::string &buffer)
+        {
+            u32_t numEdges = 0;
+            for (child_iterator EI = GTraits::child_begin(node), EE = GTraits::child_end(node); EI != EE; ++EI)
+            {
+                if (!isEdgeVisible(traits, EI)) continue;
+                appendU32(buffer, GTraits::getNodeID(node));
+                appendU32(buffer, GTraits::getNodeID(*EI));
+                if (kindColumn) appendU32(buffer, getEdgeKind(EI));
+                ++numEdges;
+            }
+            return numEdges;
+        });
+
+        out.seekp(edgeCountPos);
+        writeU64(out, numEdges);
+        out.close();
+    }
+
+    void writeGraphML(OutStream &O, const std::string &filename) const
+    {
+        std::ofstream out;
+        if (!openFile(O, out, filename))
+            return;
+
+        out << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+            << "<graphml xmlns=\"http://graphml.graphdrawing.org/xmlns\">\n";
+        if (kindColumn)
+        {
+            out << "  <key id=\"kind\" for=\"node\" attr.name=\"kind\" attr.type=\"int\"/>\n"
+                << "  <key id=\"ekind\" for=\"edge\" attr.name=\"kind\" attr.type=\"int\"/>\n";
+        }
+        if (labelColumn)
+            out << "  <key id=\"label\" for=\"node\" attr.name=\"label\" attr.type=\"string\"/>\n";
+        if (attrsColumn)
+        {
+            out << "  <key id=\"attrs\" for=\"node\" attr.name=\"attrs\" attr.type=\"string\"/>\n"
+                << "  <key id=\"eattrs\" for=\"edge\" attr.name=\"attrs\" attr.type=\"string\"/>\n";
+        }
+        out << "  <graph id=\"" << escapeXML(DOTTraits::getGraphName(G)) << "\" edgedefault=\"directed\">\n";
+
+        streamNodes(out, [this](DOTTraits &traits, NodeRef node, std::string &buffer)
+        {
+            buffer += "    <node id=\"n" + std::to_string(GTraits::getNodeID(node)) + "\">";
+            if (kindColumn)
+                buffer += "<data key=\"kind\">" + std::to_string(node->getNodeKind()) + "</data>";
+            if (labelColumn)
+                buffer += "<data key=\"label\">" + escapeXML(traits.getNodeLabel(node, G)) + "</data>";
+            if (attrsColumn)
+                buffer += "<data key=\"attrs\">" + escapeXML(traits.getNodeAttributes(node, G)) + "</data>";
+            buffer += "</node>\n";
+            return 1;
+        });
+
+        streamNodes(out, [this](DOTTraits &traits, NodeRef node, std::string &buffer)
+        {
+            u32_t numEdges = 0;
+            for (child_iterator EI = GTraits::child_begin(node), EE = GTraits::child_end(node); EI != EE; ++EI)
+            {
+                if (!isEdgeVisible(traits, EI)) continue;
+                buffer += "    <edge source=\"n" + std::to_string(GTraits::getNodeID(node)) +
+                          "\" target=\"n" + std::to_string(GTraits::getNodeID(*EI)) + "\">";
+                if (kindColumn)
+                    buffer += "<data key=\"ekind\">" + std::to_string(getEdgeKind(EI)) + "</data>";
+                if (attrsColumn)
+                    buffer += "<data key=\"eattrs\">" + escapeXML(traits.getEdgeAttributes(node, EI, G)) + "</data>";
+                buffer += "</edge>\n";
+                ++numEdges;
+            }
+            return numEdges;
+        });
+
+        out << "  </graph>\n</graphml>\n";
+        out.close();
+    }
+
+    void writeCSV(OutStream &O, const std::string &nodesFilename, const std::string &edgesFilename) const
+    {
+        std::ofstream nodesOut;
+        if (!openFile(O, nodesOut, nodesFilename))
+            return;
+
+        nodesOut << "id";
+        if (kindColumn) nodesOut << ",kind";
+        if (labelColumn) nodesOut << ",label";
+        if (attrsColumn) nodesOut << ",attrs";
+        nodesOut << "\n";
+        streamNodes(nodesOut, [this](DOTTraits &traits, NodeRef node, std::string &buffer)
+        {
+            buffer += std::to_string(GTraits::getNodeID(node));
+            if (kindColumn) buffer += "," + std::to_string(node->getNodeKind());
+            if (labelColumn) buffer += "," + escapeCSV(traits.getNodeLabel(node, G));
+            if (attrsColumn) buffer += "," + escapeCSV(traits.getNodeAttributes(node, G));
+            buffer += "\n";
+            return 1;
+        });
+        nodesOut.close();
+
+        std::ofstream edgesOut;
+        if (!openFile(O, edgesOut, edgesFilename))
+            return;
+
+        edgesOut << "src,dst";
+        if (kindColumn) edgesOut << ",kind";
+        if (attrsColumn) edgesOut << ",attrs";
+        edgesOut << "\n";
+        streamNodes(edgesOut, [this](DOTTraits &traits, NodeRef node, std::string &buffer)
+        {
+            u32_t numEdges = 0;
+            for (child_iterator EI = GTraits::child_begin(node), EE = GTraits::child_end(node); EI != EE; ++EI)
+            {
+                if (!isEdgeVisible(traits, EI)) continue;
+                buffer += std::to_string(GTraits::getNodeID(node)) + "," + std::to_string(GTraits::getNodeID(*EI));
+                if (kindColumn) buffer += "," + std::to_string(getEdgeKind(EI));
+                if (attrsColumn) buffer += "," + escapeCSV(traits.getEdgeAttributes(node, EI, G));
+                buffer += "\n";
+                ++numEdges;
+            }
+            return numEdges;
+        });
+        edgesOut.close();
+    }
+};
+
+/*!
+ * Write the graph into GraphName in the given format. DOT is written by
+ * GraphPrinter, every other format is streamed by GraphExporter.
+ */
+template<class GraphType>
+void ExportGraphToFile(OutStream &O, const std::string &GraphName, const GraphType &GT, bool simple,
+                       GraphFormat::Name format, const std::string &columns, u32_t threads)
+{
+    if (format == GraphFormat::DOT)
+    {
+        GraphPrinter::WriteGraphToFile(O, GraphName, GT, simple);
+        return;
+    }
+
+    GraphExporter<GraphType> exporter(GT, simple, columns, threads);
+    exporter.exportGraph(O, GraphName, format);
+}
+
+} // End namespace SVF
+
+#endif /* INCLUDE_GRAPHS_GRAPHEXPORTER_H_ */
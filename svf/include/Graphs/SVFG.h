@@ -389,6 +389,12 @@ protected:
     void addSVFGNodesForAddrTakenVars();
     /// Connect direct SVFG edges between two SVFG nodes (value-flow of top address-taken variables)
     void connectIndirectSVFGEdges();
+    /// (def, use) of an indirect edge and the objects flowing along it
+    typedef std::pair<NodePair, const NodeBS*> IndirectVFEdgeInfo;
+    /// Get the indirect edges within the function of a node
+    void getIntraIndirectVFEdges(const SVFGNode* node, std::vector<IndirectVFEdgeInfo>& edges) const;
+    /// Connect the indirect edges of a node across functions
+    void connectInterIndirectVFEdges(const SVFGNode* node);
     /// Connect indirect SVFG edges from global initializers (store) to main function entry
     void connectFromGlobalToProgEntry();
 
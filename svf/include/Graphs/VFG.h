@@ -451,6 +451,12 @@ protected:
 
     /// Create edges between VFG nodes within a function
     void connectDirectVFGEdges();
+    /// Get the (def, use) direct edges within the function of a node
+    void getIntraDirectVFEdges(const VFGNode* node, std::vector<NodePair>& edges) const;
+    /// Connect the direct edges of a node across functions
+    void connectInterDirectVFEdges(VFGNode* node);
+    /// Split nodes into one partition per thread, keeping the nodes of a function together
+    void partitionNodesByFunction(std::vector<std::vector<NodeID>>& partitions) const;
 
     /// Create edges between VFG nodes across functions
     void addVFGInterEdges(const CallICFGNode* cs, const SVFFunction* callee);
@@ -53,10 +53,23 @@ public:
     typedef Set<CxtThreadStmt> CxtThreadStmtSet;
     typedef Map<CxtThreadStmt,NodeBS> ThreadStmtToThreadInterleav;
     typedef Map<const SVFInstruction*,CxtThreadStmtSet> InstToThreadStmtSetMap;
+    typedef Map<CxtThreadStmt,NodeID> CxtThreadStmtToIDMap;
+    typedef std::vector<NodeBS> InterleavingRows;
     typedef SVFLoopAndDomInfo::LoopBBs LoopBBs;
 
     typedef Set<CxtStmt> LockSpan;
 
+    /// Thread summary of an instruction, built after the interleaving analysis.
+    /// A pair (t,u) is encoded as t * #threads + u.
+    struct InstThreadInfo
+    {
+        NodeBS tids;            ///< threads executing the instruction
+        NodeBS multiForkedTids; ///< the multi-forked ones among tids
+        NodeBS pairs;           ///< (t,u): some statement of thread t interleaves with thread u != t
+        NodeBS revPairs;        ///< (u,t) for every (t,u) in pairs
+    };
+    typedef Map<const SVFInstruction*,InstThreadInfo> InstToThreadInfoMap;
+
     typedef std::pair<const SVFFunction*,const SVFFunction*> FuncPair;
     typedef Map<FuncPair, bool> FuncPairToBool;
 
@@ -113,11 +126,11 @@ public:
     //@{
     inline const NodeBS& getInterleavingThreads(const CxtThreadStmt& cts)
     {
-        return threadStmtToTheadInterLeav[cts];
+        return interleavingRows[getCxtThreadStmtID(cts)];
     }
     inline bool hasInterleavingThreads(const CxtThreadStmt& cts) const
     {
-        return threadStmtToTheadInterLeav.find(cts)!=threadStmtToTheadInterLeav.end();
+        return ctsToID.find(cts)!=ctsToID.end();
     }
     //@}
 
@@ -140,6 +153,18 @@ public:
 
 private:
 
+    /// Dense id of a contexted thread statement, indexing its interleaving row
+    inline NodeID getCxtThreadStmtID(const CxtThreadStmt& cts)
+    {
+        std::pair<CxtThreadStmtToIDMap::iterator, bool> res = ctsToID.emplace(cts, interleavingRows.size());
+        if(res.second)
+            interleavingRows.push_back(NodeBS());
+        return res.first->second;
+    }
+
+    /// Build the per-instruction thread summaries answering pair queries
+    void buildThreadInfoIndex();
+
     inline const PTACallGraph::FunctionSet& getCallee(const SVFInstruction* inst, PTACallGraph::FunctionSet& callees)
     {
         tcg->getCallees(getCBN(inst), callees);
@@ -171,7 +196,7 @@ private:
     //@{
     inline void addInterleavingThread(const CxtThreadStmt& tgr, NodeID tid)
     {
-        if(threadStmtToTheadInterLeav[tgr].test_and_set(tid))
+        if(interleavingRows[getCxtThreadStmtID(tgr)].test_and_set(tid))
         {
             instToTSMap[tgr.getStmt()].insert(tgr);
             pushToCTSWorkList(tgr);
@@ -179,7 +204,9 @@ private:
     }
     inline void addInterleavingThread(const CxtThreadStmt& tgr, const CxtThreadStmt& src)
     {
-        bool changed = threadStmtToTheadInterLeav[tgr] |= threadStmtToTheadInterLeav[src];
+        NodeID tgrID = getCxtThreadStmtID(tgr);
+        NodeID srcID = getCxtThreadStmtID(src);
+        bool changed = interleavingRows[tgrID] |= interleavingRows[srcID];
         if(changed)
         {
             instToTSMap[tgr.getStmt()].insert(tgr);
@@ -194,7 +221,7 @@ private:
             if(isMustJoin(tgr.getTid(),joinsite))
                 joinedTids.set(*it);
         }
-        if(threadStmtToTheadInterLeav[tgr].intersectWithComplement(joinedTids))
+        if(interleavingRows[getCxtThreadStmtID(tgr)].intersectWithComplement(joinedTids))
         {
             pushToCTSWorkList(tgr);
         }
@@ -268,8 +295,10 @@ private:
     TCT* tct;							///< TCT
     ForkJoinAnalysis* fja;				///< ForJoin Analysis
     CxtThreadStmtWorkList cxtStmtList;	///< CxtThreadStmt worklist
-    ThreadStmtToThreadInterleav threadStmtToTheadInterLeav; /// Map a statement to its thread interleavings
+    CxtThreadStmtToIDMap ctsToID;		///< Map a statement to the id of its interleaving row
+    InterleavingRows interleavingRows;	///< Thread interleavings of each statement, indexed by id
     InstToThreadStmtSetMap instToTSMap; ///< Map an instruction to its ThreadStmtSet
+    InstToThreadInfoMap instToThreadInfo; ///< Map an instruction to its thread summary
     FuncPairToBool nonCandidateFuncMHPRelMap;
 
 
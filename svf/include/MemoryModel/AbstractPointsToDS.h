@@ -91,6 +91,9 @@ public:
         PersDataFlow,
         PersIncDataFlow,
         PersVersioned,
+        SpillDataFlow,
+        SpillIncDataFlow,
+        Frozen,
     };
 
     PTData(bool reversePT = true, PTDataTy ty = PTDataTy::Base) : rev(reversePT), ptdTy(ty) { }
@@ -257,7 +260,9 @@ public:
                || ptd->getPTDTY() == BasePTData::MutDataFlow
                || ptd->getPTDTY() == BasePTData::MutIncDataFlow
                || ptd->getPTDTY() == BasePTData::PersDataFlow
-               || ptd->getPTDTY() == BasePTData::PersIncDataFlow;
+               || ptd->getPTDTY() == BasePTData::PersIncDataFlow
+               || ptd->getPTDTY() == BasePTData::SpillDataFlow
+               || ptd->getPTDTY() == BasePTData::SpillIncDataFlow;
     }
     ///@}
 };
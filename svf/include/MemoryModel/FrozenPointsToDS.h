@@ -0,0 +1,188 @@
+/// PTData (AbstractPointsToDS.h) implementation for final, read-only results.
+/// Points-to sets are hash-consed into one contiguous pool and each Key holds
+/// the index of its set in a flat array.
+
+/*
+ * FrozenPointsToDS.h
+ *
+ * A solved analysis only reads its points-to sets, so the structures needed
+ * for solving (diff and propagated sets, reverse points-to sets, the
+ * persistent cache's operation memos and intermediate sets) can be dropped.
+ */
+
+#ifndef FROZEN_POINTSTO_H_
+#define FROZEN_POINTSTO_H_
+
+#include "MemoryModel/AbstractPointsToDS.h"
+#include "Util/SVFUtil.h"
+
+namespace SVF
+{
+
+/// Read-only PTData. Key must be a dense integral ID (e.g. NodeID) since it
+/// indexes the key-to-set array directly. Sets are added with freezePts before
+/// any read; the mutating PTData methods are not supported.
+template <typename Key, typename KeySet, typename Data, typename DataSet>
+class FrozenPTData : public PTData<Key, KeySet, Data, DataSet>
+{
+public:
+    typedef PTData<Key, KeySet, Data, DataSet> BasePTData;
+    typedef typename BasePTData::PTDataTy PTDataTy;
+
+    /// Index of a points-to set in the pool.
+    typedef u32_t FrozenPtsID;
+
+    /// Constructor
+    FrozenPTData() : BasePTData(false, PTDataTy::Frozen)
+    {
+        clear();
+    }
+
+    ~FrozenPTData() override = default;
+
+    inline void clear() override
+    {
+        pool.clear();
+        keyToPts.clear();
+        ptsToID.clear();
+        // The empty set always has ID 0 so unknown keys need no entry.
+        pool.push_back(DataSet());
+        ptsToID[pool[0]] = 0;
+    }
+
+    /// Stores pts as the points-to set of var; identical sets are stored once.
+    inline void freezePts(const Key& var, const DataSet& pts)
+    {
+        if (pts.empty()) return;
+
+        std::pair<typename Map<DataSet, FrozenPtsID>::iterator, bool> idIt = ptsToID.emplace(pts, pool.size());
+        if (idIt.second) pool.push_back(pts);
+
+        if (var >= keyToPts.size()) keyToPts.resize(var + 1, 0);
+        keyToPts[var] = idIt.first->second;
+    }
+
+    /// Drops the hash-consing table once every set has been frozen.
+    inline void finishFreezing()
+    {
+        Map<DataSet, FrozenPtsID>().swap(ptsToID);
+        pool.shrink_to_fit();
+        keyToPts.shrink_to_fit();
+    }
+
+    inline const DataSet& getPts(const Key& var) override
+    {
+        if (var >= keyToPts.size()) return pool[0];
+        return pool[keyToPts[var]];
+    }
+
+    inline const KeySet& getRevPts(const Data&) override
+    {
+        assert(false && "FrozenPTData::getRevPts: not supported!");
+        abort();
+    }
+
+    inline bool addPts(const Key&, const Data&) override
+    {
+        assert(false && "FrozenPTData::addPts: points-to sets are frozen!");
+        abort();
+    }
+
+    inline bool unionPts(const Key&, const Key&) override
+    {
+        assert(false && "FrozenPTData::unionPts: points-to sets are frozen!");
+        abort();
+    }
+
+    inline bool unionPts(const Key&, const DataSet&) override
+    {
+        assert(false && "FrozenPTData::unionPts: points-to sets are frozen!");
+        abort();
+    }
+
+    inline void clearPts(const Key&, const Data&) override
+    {
+        assert(false && "FrozenPTData::clearPts: points-to sets are frozen!");
+        abort();
+    }
+
+    inline void clearFullPts(const Key&) override
+    {
+        assert(false && "FrozenPTData::clearFullPts: points-to sets are frozen!");
+        abort();
+    }
+
+    /// Remapping keeps every set's contents, so it is allowed.
+    inline void remapAllPts() override
+    {
+        for (DataSet &pts : pool) pts.checkAndRemap();
+    }
+
+    inline void dumpPTData() override
+    {
+        for (size_t var = 0; var < keyToPts.size(); ++var)
+        {
+            const DataSet &pts = pool[keyToPts[var]];
+            if (pts.empty()) continue;
+
+            SVFUtil::outs() << var << " ==> { ";
+            for (const Data &d : pts) SVFUtil::outs() << d << " ";
+            SVFUtil::outs() << "}\n";
+        }
+    }
+
+    Map<DataSet, unsigned> getAllPts(bool) const override
+    {
+        std::vector<unsigned> occurrences(pool.size(), 0);
+        for (const FrozenPtsID id : keyToPts) ++occurrences[id];
+
+        Map<DataSet, unsigned> allPts;
+        for (FrozenPtsID id = 1; id < pool.size(); ++id) allPts[pool[id]] = occurrences[id];
+        return allPts;
+    }
+
+    /// Statistics.
+    ///@{
+    inline u32_t getNumKeys() const
+    {
+        return keyToPts.size();
+    }
+    /// Number of distinct non-empty points-to sets.
+    inline u32_t getNumUniquePts() const
+    {
+        return pool.size() - 1;
+    }
+    /// Total number of elements over the pool.
+    inline u32_t getNumStoredElements() const
+    {
+        u32_t elements = 0;
+        for (const DataSet &pts : pool) elements += pts.count();
+        return elements;
+    }
+    ///@}
+
+    /// Methods to support type inquiry through isa, cast, and dyn_cast:
+    ///@{
+    static inline bool classof(const FrozenPTData<Key, KeySet, Data, DataSet> *)
+    {
+        return true;
+    }
+
+    static inline bool classof(const PTData<Key, KeySet, Data, DataSet>* ptd)
+    {
+        return ptd->getPTDTY() == PTDataTy::Frozen;
+    }
+    ///@}
+
+private:
+    /// Distinct points-to sets; pool[0] is the empty set.
+    std::vector<DataSet> pool;
+    /// keyToPts[k] is the index in pool of the points-to set of key k.
+    std::vector<FrozenPtsID> keyToPts;
+    /// Only used while freezing.
+    Map<DataSet, FrozenPtsID> ptsToID;
+};
+
+} // End namespace SVF
+
+#endif  // FROZEN_POINTSTO_H_
@@ -38,6 +38,8 @@
 #include "MemoryModel/AbstractPointsToDS.h"
 #include "MemoryModel/MutablePointsToDS.h"
 #include "MemoryModel/PersistentPointsToDS.h"
+#include "MemoryModel/SpilledPointsToDS.h"
+#include "MemoryModel/FrozenPointsToDS.h"
 #include "Graphs/PTACallGraph.h"
 #include "Graphs/CHG.h"
 #include "Util/SCC.h"
@@ -67,6 +69,8 @@ public:
         Andersen_WPA,		///< Andersen PTA
         AndersenSCD_WPA,    ///< Selective cycle detection andersen-style WPA
         AndersenSFR_WPA,    ///< Stride-based field representation
+        AndersenLCD_WPA,    ///< Lazy cycle detection andersen-style WPA
+        AndersenHCD_WPA,    ///< Hybrid (offline + lazy) cycle detection andersen-style WPA
         AndersenWaveDiff_WPA,	///< Diff wave propagation andersen-style WPA
         Steensgaard_WPA,      ///< Steensgaard PTA
         CSCallString_WPA,	///< Call string based context sensitive WPA
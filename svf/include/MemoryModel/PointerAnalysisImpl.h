@@ -60,11 +60,17 @@ public:
     typedef PersistentIncDFPTData<NodeID, NodeSet, NodeID, PointsTo> PersIncDFPTDataTy;
     typedef PersistentVersionedPTData<NodeID, NodeSet, NodeID, PointsTo, VersionedVar, Set<VersionedVar>> PersVersionedPTDataTy;
 
+    typedef SpilledDFPTData<NodeID, NodeSet, NodeID, PointsTo, MutableDFPTData> SpillDFPTDataTy;
+    typedef SpilledDFPTData<NodeID, NodeSet, NodeID, PointsTo, MutableIncDFPTData> SpillIncDFPTDataTy;
+
+    typedef FrozenPTData<NodeID, NodeSet, NodeID, PointsTo> FrozenPTDataTy;
+
     /// How the PTData used is implemented.
     enum PTBackingType
     {
         Mutable,
         Persistent,
+        Spilled,
     };
 
     /// Constructor
@@ -78,6 +84,11 @@ public:
         return ptCache;
     }
 
+    inline PointsToSpillFile &getSpillFile()
+    {
+        return spillFile;
+    }
+
     static inline bool classof(const PointerAnalysis *pta)
     {
         return pta->getImplTy() == BVDataImpl;
@@ -138,6 +149,12 @@ public:
     /// Remap all points-to sets to use the current mapping.
     void remapPointsToSets(void);
 
+    /// Whether the points-to sets have been frozen (see freezePointsTo).
+    inline bool isPointsToFrozen() const
+    {
+        return SVFUtil::isa<FrozenPTDataTy>(ptD.get());
+    }
+
     /// Interface for analysis result storage on filesystem.
     //@{
     virtual void writeToFile(const std::string& filename);
@@ -198,12 +215,26 @@ protected:
     /// i.e., replace fieldObj with baseObj if it is field-insensitive
     virtual void normalizePointsTo();
 
+    /// Replace the solving points-to data (diff, propagated and reverse points-to
+    /// sets, the persistent cache) of a solved analysis with a FrozenPTData holding
+    /// each distinct points-to set once. Reads still go through getPts; updates are
+    /// no longer possible. Only diff and data-flow points-to data are frozen; for the
+    /// latter only top-level pointers keep their sets.
+    void freezePointsTo();
+
 private:
+    /// Backs a spilled ptD, so it is declared (and destroyed) before it.
+    PointsToSpillFile spillFile;
+
     /// Points-to data
     std::unique_ptr<PTDataTy> ptD;
 
     PersistentPointsToCache<PointsTo> ptCache;
 
+    /// Function (or vtable) pointer targets of each indirect callsite which have
+    /// already been resolved by onTheFlyCallGraphSolve.
+    Map<const CallICFGNode*, PointsTo> resolvedIndCallPts;
+
 public:
     /// Interface expose to users of our pointer analysis, given Value infos
     AliasResult alias(const SVFValue* V1,
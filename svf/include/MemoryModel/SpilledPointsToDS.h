@@ -0,0 +1,552 @@
+/// DFPTData (AbstractPointsToDS.h) implementation with a memory budget.
+/// The IN/OUT points-to sets of the least recently used locations (SVFG nodes)
+/// are moved to a memory-mapped spill file in compressed form and read back
+/// when the location is accessed again.
+
+/*
+ * SpilledPointsToDS.h
+ *
+ * The sets are the mutable ones (MutableDFPTData or MutableIncDFPTData); only
+ * which locations are resident changes. The resident size is an estimate
+ * from the number of sparse bit vector elements of each set, refreshed every
+ * budgetCheckInterval operations for the locations touched since the last
+ * check. Locations are only spilled when an outermost operation starts, so
+ * references handed out during an operation stay valid.
+ */
+
+#ifndef SPILLED_POINTSTO_H_
+#define SPILLED_POINTSTO_H_
+
+#include "MemoryModel/MutablePointsToDS.h"
+#include <list>
+#include <map>
+
+namespace SVF
+{
+
+/// Backing file of spilled points-to data, mapped into memory. Freed extents
+/// are reused best-fit. The file is created on the first write and removed
+/// when this is destroyed. Also keeps the spill statistics.
+class PointsToSpillFile
+{
+public:
+    typedef u64_t Offset;
+
+    PointsToSpillFile() : path(), fd(-1), base(nullptr), capacity(0), end(0), liveBytes(0),
+        numSpills(0), numFaults(0), spilledBytes(0), spilledSetBytes(0),
+        residentBytes(0), peakResidentBytes(0), budgetBytes(0)
+    {
+    }
+
+    ~PointsToSpillFile();
+
+    /// Where to create the file; empty for an anonymous file in $TMPDIR.
+    inline void setPath(const std::string& p)
+    {
+        path = p;
+    }
+
+    /// Copies size bytes into the file and returns their offset.
+    Offset write(const unsigned char* data, size_t size);
+
+    /// The bytes written at offset. Valid until the next write.
+    inline const unsigned char* read(Offset offset) const
+    {
+        assert(offset < end && "PointsToSpillFile::read: offset out of range!");
+        return base + offset;
+    }
+
+    /// Frees the size bytes written at offset.
+    void release(Offset offset, size_t size);
+
+    /// Statistics.
+    ///@{
+    inline void recordSpill(u64_t compressedBytes, u64_t setBytes)
+    {
+        ++numSpills;
+        spilledBytes += compressedBytes;
+        spilledSetBytes += setBytes;
+    }
+    inline void recordFault()
+    {
+        ++numFaults;
+    }
+    inline void setResidentBytes(u64_t bytes)
+    {
+        residentBytes = bytes;
+        if (bytes > peakResidentBytes) peakResidentBytes = bytes;
+    }
+    inline void setBudgetBytes(u64_t bytes)
+    {
+        budgetBytes = bytes;
+    }
+    void printStats() const;
+    ///@}
+
+    /// Variable-length encoding of the spilled data.
+    ///@{
+    static inline void writeVarint(std::vector<unsigned char>& buf, u64_t v)
+    {
+        while (v >= 0x80)
+        {
+            buf.push_back((unsigned char)(v | 0x80));
+            v >>= 7;
+        }
+        buf.push_back((unsigned char)v);
+    }
+    static inline u64_t readVarint(const unsigned char*& p)
+    {
+        u64_t v = 0;
+        for (unsigned shift = 0; ; shift += 7)
+        {
+            unsigned char byte = *p++;
+            v |= (u64_t)(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) return v;
+        }
+    }
+    ///@}
+
+private:
+    std::string path;
+    int fd;
+    unsigned char* base;
+    u64_t capacity;
+    /// End of the used part of the file.
+    Offset end;
+    u64_t liveBytes;
+    /// Free extents by size.
+    std::multimap<u64_t, Offset> freeExtents;
+
+    u64_t numSpills;
+    u64_t numFaults;
+    u64_t spilledBytes;
+    u64_t spilledSetBytes;
+    u64_t residentBytes;
+    u64_t peakResidentBytes;
+    u64_t budgetBytes;
+
+    void open();
+    void grow(u64_t minCapacity);
+
+    /// Extents are allocated in multiples of this, so a location spilled
+    /// again with a slightly larger set can reuse its old extent.
+    static inline u64_t extentSize(size_t size)
+    {
+        return (size + 63) & ~(u64_t)63;
+    }
+};
+
+/// DFPTData keeping the IN/OUT sets of at most (about) budget bytes of
+/// locations in memory. MutDFPTData is MutableDFPTData or MutableIncDFPTData.
+template <typename Key, typename KeySet, typename Data, typename DataSet,
+          template <typename, typename, typename, typename> class MutDFPTData>
+class SpilledDFPTData : public MutDFPTData<Key, KeySet, Data, DataSet>
+{
+public:
+    typedef PTData<Key, KeySet, Data, DataSet> BasePTData;
+    typedef DFPTData<Key, KeySet, Data, DataSet> BaseDFPTData;
+    typedef MutDFPTData<Key, KeySet, Data, DataSet> BaseMutDFPTData;
+    typedef typename BasePTData::PTDataTy PTDataTy;
+
+    typedef typename BaseDFPTData::LocID LocID;
+    typedef typename BaseMutDFPTData::PtsMap PtsMap;
+
+    /// Number of outermost operations between two budget checks.
+    static const u32_t budgetCheckInterval = 1024;
+
+    /// Constructor
+    SpilledDFPTData(PointsToSpillFile& file, u64_t budget, bool reversePT = true, PTDataTy ty = BasePTData::SpillDataFlow)
+        : BaseMutDFPTData(reversePT, ty), spillFile(file), budgetBytes(budget), residentBytes(0), opDepth(0), opsSinceCheck(0)
+    {
+        spillFile.setBudgetBytes(budgetBytes);
+    }
+
+    ~SpilledDFPTData() override
+    {
+        for (const typename Map<LocID, SpillRecord>::value_type& lr : spilled)
+            spillFile.release(lr.second.offset, lr.second.size);
+    }
+
+    inline bool hasDFInSet(LocID loc) const override
+    {
+        return BaseMutDFPTData::hasDFInSet(loc) || spilledHas(loc, hasInFlag);
+    }
+
+    inline bool hasDFOutSet(LocID loc) const override
+    {
+        return BaseMutDFPTData::hasDFOutSet(loc) || spilledHas(loc, hasOutFlag);
+    }
+
+    inline bool hasDFInSet(LocID loc, const Key& var) const override
+    {
+        return BaseMutDFPTData::hasDFInSet(loc, var) || spilledHasVar(loc, true, var);
+    }
+
+    inline bool hasDFOutSet(LocID loc, const Key& var) const override
+    {
+        return BaseMutDFPTData::hasDFOutSet(loc, var) || spilledHasVar(loc, false, var);
+    }
+
+    inline DataSet& getDFInPtsSet(LocID loc, const Key& var) override
+    {
+        OpScope scope(*this);
+        touch(loc);
+        return BaseMutDFPTData::getDFInPtsSet(loc, var);
+    }
+
+    inline DataSet& getDFOutPtsSet(LocID loc, const Key& var) override
+    {
+        OpScope scope(*this);
+        touch(loc);
+        return BaseMutDFPTData::getDFOutPtsSet(loc, var);
+    }
+
+    /// The updates reach the sets through getDFInPtsSet/getDFOutPtsSet, which
+    /// bring spilled locations back.
+    ///@{
+    inline bool updateDFInFromIn(LocID srcLoc, const Key& srcVar, LocID dstLoc, const Key& dstVar) override
+    {
+        OpScope scope(*this);
+        return BaseMutDFPTData::updateDFInFromIn(srcLoc, srcVar, dstLoc, dstVar);
+    }
+
+    inline bool updateAllDFInFromIn(LocID srcLoc, const Key& srcVar, LocID dstLoc, const Key& dstVar) override
+    {
+        OpScope scope(*this);
+        return BaseMutDFPTData::updateAllDFInFromIn(srcLoc, srcVar, dstLoc, dstVar);
+    }
+
+    inline bool updateDFInFromOut(LocID srcLoc, const Key& srcVar, LocID dstLoc, const Key& dstVar) override
+    {
+        OpScope scope(*this);
+        return BaseMutDFPTData::updateDFInFromOut(srcLoc, srcVar, dstLoc, dstVar);
+    }
+
+    inline bool updateAllDFInFromOut(LocID srcLoc, const Key& srcVar, LocID dstLoc, const Key& dstVar) override
+    {
+        OpScope scope(*this);
+        return BaseMutDFPTData::updateAllDFInFromOut(srcLoc, srcVar, dstLoc, dstVar);
+    }
+
+    inline bool updateDFOutFromIn(LocID srcLoc, const Key& srcVar, LocID dstLoc, const Key& dstVar) override
+    {
+        OpScope scope(*this);
+        return BaseMutDFPTData::updateDFOutFromIn(srcLoc, srcVar, dstLoc, dstVar);
+    }
+
+    inline bool updateAllDFOutFromIn(LocID loc, const Key& singleton, bool strongUpdates) override
+    {
+        OpScope scope(*this);
+        // MutableDFPTData walks the IN set of loc directly.
+        touch(loc);
+        return BaseMutDFPTData::updateAllDFOutFromIn(loc, singleton, strongUpdates);
+    }
+
+    inline void clearAllDFOutUpdatedVar(LocID loc) override
+    {
+        OpScope scope(*this);
+        BaseMutDFPTData::clearAllDFOutUpdatedVar(loc);
+    }
+
+    inline bool updateTLVPts(LocID srcLoc, const Key& srcVar, const Key& dstVar) override
+    {
+        OpScope scope(*this);
+        return BaseMutDFPTData::updateTLVPts(srcLoc, srcVar, dstVar);
+    }
+
+    inline bool updateATVPts(const Key& srcVar, LocID dstLoc, const Key& dstVar) override
+    {
+        OpScope scope(*this);
+        return BaseMutDFPTData::updateATVPts(srcVar, dstLoc, dstVar);
+    }
+    ///@}
+
+    inline Map<DataSet, unsigned> getAllPts(bool liveOnly) const override
+    {
+        Map<DataSet, unsigned> allPts = BaseMutDFPTData::getAllPts(liveOnly);
+        for (const typename Map<LocID, SpillRecord>::value_type& lr : spilled)
+        {
+            PtsMap in, out;
+            decode(spillFile.read(lr.second.offset), in, out);
+            for (const typename PtsMap::value_type& vpt : in) ++allPts[vpt.second];
+            for (const typename PtsMap::value_type& vpt : out) ++allPts[vpt.second];
+        }
+        return allPts;
+    }
+
+    /// Brings every location back (ignoring the budget) before dumping.
+    inline void dumpPTData() override
+    {
+        std::vector<LocID> locs;
+        for (const typename Map<LocID, SpillRecord>::value_type& lr : spilled)
+            locs.push_back(lr.first);
+        for (LocID loc : locs)
+            touch(loc);
+        BaseMutDFPTData::dumpPTData();
+    }
+
+    /// Methods to support type inquiry through isa, cast, and dyn_cast:
+    ///@{
+    static inline bool classof(const SpilledDFPTData<Key, KeySet, Data, DataSet, MutDFPTData> *)
+    {
+        return true;
+    }
+    static inline bool classof(const PTData<Key, KeySet, Data, DataSet>* ptd)
+    {
+        return ptd->getPTDTY() == BasePTData::SpillDataFlow
+               || ptd->getPTDTY() == BasePTData::SpillIncDataFlow;
+    }
+    ///@}
+
+private:
+    /// Where a spilled location's sets are in the spill file.
+    struct SpillRecord
+    {
+        PointsToSpillFile::Offset offset;
+        size_t size;
+    };
+
+    /// Bookkeeping of a resident location.
+    struct ResidentLoc
+    {
+        typename std::list<LocID>::iterator lruIt;
+        u64_t bytes;
+        bool dirty;
+    };
+
+    /// Flags in the first byte of a record.
+    static const unsigned char hasInFlag = 0x1;
+    static const unsigned char hasOutFlag = 0x2;
+
+    /// Estimated bytes of a map entry besides its set, and of one sparse bit vector element.
+    static const u64_t entryBytes = 64;
+    static const u64_t elementBytes = 48;
+
+    /// Starts every operation; the outermost one may spill locations.
+    class OpScope
+    {
+    public:
+        explicit OpScope(SpilledDFPTData& d) : ptd(d)
+        {
+            if (ptd.opDepth++ == 0) ptd.checkBudget();
+        }
+        ~OpScope()
+        {
+            --ptd.opDepth;
+        }
+    private:
+        SpilledDFPTData& ptd;
+    };
+
+    PointsToSpillFile& spillFile;
+    u64_t budgetBytes;
+    u64_t residentBytes;
+    u32_t opDepth;
+    u32_t opsSinceCheck;
+
+    /// Resident locations, most recently used first.
+    std::list<LocID> lru;
+    Map<LocID, ResidentLoc> resident;
+    /// Locations touched since the last budget check, whose size may have changed.
+    std::vector<LocID> dirtyLocs;
+    Map<LocID, SpillRecord> spilled;
+    /// Reused encoding buffer.
+    std::vector<unsigned char> buffer;
+
+    /// Marks loc as most recently used, bringing it back if it was spilled.
+    inline void touch(LocID loc)
+    {
+        typename Map<LocID, ResidentLoc>::iterator it = resident.find(loc);
+        if (it != resident.end())
+        {
+            lru.splice(lru.begin(), lru, it->second.lruIt);
+            if (!it->second.dirty)
+            {
+                it->second.dirty = true;
+                dirtyLocs.push_back(loc);
+            }
+            return;
+        }
+
+        faultIn(loc);
+        lru.push_front(loc);
+        resident[loc] = {lru.begin(), 0, true};
+        dirtyLocs.push_back(loc);
+    }
+
+    /// Re-estimates the locations touched since the last check and spills
+    /// the least recently used ones while over budget.
+    void checkBudget()
+    {
+        if (++opsSinceCheck < budgetCheckInterval)
+            return;
+        opsSinceCheck = 0;
+
+        for (LocID loc : dirtyLocs)
+        {
+            typename Map<LocID, ResidentLoc>::iterator it = resident.find(loc);
+            if (it == resident.end())
+                continue;
+            residentBytes -= it->second.bytes;
+            it->second.bytes = estimateBytes(loc);
+            it->second.dirty = false;
+            residentBytes += it->second.bytes;
+        }
+        dirtyLocs.clear();
+        spillFile.setResidentBytes(residentBytes);
+
+        if (residentBytes <= budgetBytes)
+            return;
+
+        // Spill down to 90% of the budget so that the next few checks do not spill again.
+        const u64_t target = budgetBytes - budgetBytes / 10;
+        while (residentBytes > target && !lru.empty())
+            spill(lru.back());
+        spillFile.setResidentBytes(residentBytes);
+    }
+
+    inline u64_t estimateBytes(const PtsMap& ptsMap) const
+    {
+        u64_t bytes = 0;
+        for (const typename PtsMap::value_type& vpt : ptsMap)
+        {
+            bytes += entryBytes;
+            // Elements of a sparse bit vector hold 128 bits each.
+            s64_t lastElement = -1;
+            for (const Data d : vpt.second)
+            {
+                if ((s64_t)(d / 128) != lastElement)
+                {
+                    lastElement = d / 128;
+                    bytes += elementBytes;
+                }
+            }
+        }
+        return bytes;
+    }
+
+    inline u64_t estimateBytes(LocID loc) const
+    {
+        u64_t bytes = entryBytes;
+        typename BaseMutDFPTData::DFPtsMapconstIter in = this->dfInPtsMap.find(loc);
+        if (in != this->dfInPtsMap.end()) bytes += estimateBytes(in->second);
+        typename BaseMutDFPTData::DFPtsMapconstIter out = this->dfOutPtsMap.find(loc);
+        if (out != this->dfOutPtsMap.end()) bytes += estimateBytes(out->second);
+        return bytes;
+    }
+
+    /// Record: flags, then the IN and OUT maps present as
+    /// <#vars> (<var> <#elements> <zigzag delta of each element>)*.
+    inline void encode(const PtsMap& ptsMap)
+    {
+        PointsToSpillFile::writeVarint(buffer, ptsMap.size());
+        for (const typename PtsMap::value_type& vpt : ptsMap)
+        {
+            PointsToSpillFile::writeVarint(buffer, vpt.first);
+            PointsToSpillFile::writeVarint(buffer, vpt.second.count());
+            s64_t prev = 0;
+            for (const Data d : vpt.second)
+            {
+                // Elements need not come in increasing order once IDs are remapped.
+                s64_t delta = (s64_t)d - prev;
+                PointsToSpillFile::writeVarint(buffer, ((u64_t)delta << 1) ^ (u64_t)(delta >> 63));
+                prev = d;
+            }
+        }
+    }
+
+    static inline void decode(const unsigned char*& p, PtsMap& ptsMap)
+    {
+        u64_t numVars = PointsToSpillFile::readVarint(p);
+        for (u64_t i = 0; i < numVars; ++i)
+        {
+            Key var = PointsToSpillFile::readVarint(p);
+            DataSet& pts = ptsMap[var];
+            u64_t numElements = PointsToSpillFile::readVarint(p);
+            s64_t prev = 0;
+            for (u64_t e = 0; e < numElements; ++e)
+            {
+                u64_t zigzag = PointsToSpillFile::readVarint(p);
+                prev += (s64_t)(zigzag >> 1) ^ -(s64_t)(zigzag & 1);
+                pts.set(prev);
+            }
+        }
+    }
+
+    static inline void decode(const unsigned char* p, PtsMap& in, PtsMap& out)
+    {
+        unsigned char flags = *p++;
+        if (flags & hasInFlag) decode(p, in);
+        if (flags & hasOutFlag) decode(p, out);
+    }
+
+    /// Moves the sets of resident location loc to the spill file.
+    void spill(LocID loc)
+    {
+        typename Map<LocID, ResidentLoc>::iterator it = resident.find(loc);
+        assert(it != resident.end() && "SpilledDFPTData::spill: location not resident!");
+        const u64_t bytes = it->second.bytes;
+        residentBytes -= bytes;
+        lru.erase(it->second.lruIt);
+        resident.erase(it);
+
+        typename BaseMutDFPTData::DFPtsMap::iterator in = this->dfInPtsMap.find(loc);
+        typename BaseMutDFPTData::DFPtsMap::iterator out = this->dfOutPtsMap.find(loc);
+        unsigned char flags = 0;
+        if (in != this->dfInPtsMap.end()) flags |= hasInFlag;
+        if (out != this->dfOutPtsMap.end()) flags |= hasOutFlag;
+        if (flags == 0)
+            return;
+
+        buffer.clear();
+        buffer.push_back(flags);
+        if (in != this->dfInPtsMap.end()) encode(in->second);
+        if (out != this->dfOutPtsMap.end()) encode(out->second);
+
+        spilled[loc] = {spillFile.write(buffer.data(), buffer.size()), buffer.size()};
+        spillFile.recordSpill(buffer.size(), bytes);
+
+        if (in != this->dfInPtsMap.end()) this->dfInPtsMap.erase(in);
+        if (out != this->dfOutPtsMap.end()) this->dfOutPtsMap.erase(out);
+    }
+
+    /// Reads the sets of loc back from the spill file, if loc was spilled.
+    void faultIn(LocID loc)
+    {
+        typename Map<LocID, SpillRecord>::iterator it = spilled.find(loc);
+        if (it == spilled.end())
+            return;
+
+        const unsigned char* p = spillFile.read(it->second.offset);
+        unsigned char flags = *p++;
+        if (flags & hasInFlag) decode(p, this->dfInPtsMap[loc]);
+        if (flags & hasOutFlag) decode(p, this->dfOutPtsMap[loc]);
+
+        spillFile.release(it->second.offset, it->second.size);
+        spilled.erase(it);
+        spillFile.recordFault();
+    }
+
+    inline bool spilledHas(LocID loc, unsigned char flag) const
+    {
+        typename Map<LocID, SpillRecord>::const_iterator it = spilled.find(loc);
+        return it != spilled.end() && (*spillFile.read(it->second.offset) & flag);
+    }
+
+    /// Looks var up in a spilled location without bringing it back.
+    bool spilledHasVar(LocID loc, bool inSet, const Key& var) const
+    {
+        typename Map<LocID, SpillRecord>::const_iterator it = spilled.find(loc);
+        if (it == spilled.end())
+            return false;
+
+        PtsMap in, out;
+        decode(spillFile.read(it->second.offset), in, out);
+        const PtsMap& ptsMap = inSet ? in : out;
+        return ptsMap.find(var) != ptsMap.end();
+    }
+};
+
+} // End namespace SVF
+
+#endif  // SPILLED_POINTSTO_H_
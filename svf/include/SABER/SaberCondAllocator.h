@@ -34,7 +34,7 @@
 #include "SVFIR/SVFValue.h"
 #include "Util/WorkList.h"
 #include "Graphs/SVFG.h"
-#include "Util/Z3Expr.h"
+#include "SABER/SaberCondition.h"
 
 
 namespace SVF
@@ -48,7 +48,7 @@ class SaberCondAllocator
 
 public:
 
-    typedef Z3Expr Condition;   /// z3 condition
+    typedef SaberCondition Condition;   /// z3 or BDD condition
     typedef Map<u32_t, const SVFInstruction *> IndexToTermInstMap; /// id to instruction map for z3
     typedef Map<u32_t,Condition> CondPosMap;		///< map a branch to its Condition
     typedef Map<const SVFBasicBlock*, CondPosMap > BBCondMap;	/// map bb to a Condition
@@ -57,6 +57,24 @@ public:
     typedef Map<const SVFBasicBlock*, Condition> BBToCondMap;	///< map a basic block to its condition during control-flow guard computation
     typedef FIFOWorkList<const SVFBasicBlock*> CFWorkList;	///< worklist for control-flow guard computation
 
+    /// Cached solver queries. A cache entry keeps its conditions alive so that
+    /// their Z3 ids, which are the cache keys, are not recycled.
+    //@{
+    struct EquivQuery
+    {
+        Condition lhs;
+        Condition rhs;
+        bool equivalent;
+    };
+    struct SatQuery
+    {
+        Condition cond;
+        bool satisfiable;
+    };
+    typedef Map<std::pair<u32_t,u32_t>, EquivQuery> EquivQueryCache;	///< (smaller id, larger id) to result
+    typedef Map<u32_t, SatQuery> SatQueryCache;	///< condition id to result
+    //@}
+
 
     /// Constructor
     SaberCondAllocator();
@@ -64,6 +82,7 @@ public:
     /// Destructor
     virtual ~SaberCondAllocator()
     {
+        delete querySolver;
     }
     /// Statistics
     //@{
@@ -79,6 +98,9 @@ public:
     {
         return totalCondNum;
     }
+    /// Print the number of path-condition queries and how many of them were answered without Z3,
+    /// or the BDD table statistics under the BDD backend
+    void printQueryStat() const;
     //@}
 
     /// Condition operations
@@ -291,6 +313,9 @@ private:
     /// extract subexpression from a Z3 expression
     void extractSubConds(const Condition &condition, NodeBS &support) const;
 
+    /// Check formula under a fresh assumption literal on the incremental query solver
+    z3::check_result checkUnderAssumption(const z3::expr& formula) const;
+
 
     FunToExitBBsMap funToExitBBsMap;		///< map a function to all its basic blocks calling program exit
     BBToCondMap bbToCondMap;				///< map a basic block to its path condition starting from root
@@ -300,6 +325,23 @@ private:
     std::vector<Condition> conditionVec;          /// vector storing z3expression
     static u32_t totalCondNum; /// a counter for fresh condition
 
+    /// Incremental solver for path-condition queries, reset after maxAssumptionLits queries
+    mutable z3::solver* querySolver{nullptr};
+    mutable u32_t numOfAssumptionLits{0};
+    static const u32_t maxAssumptionLits = 4096;
+    mutable EquivQueryCache equivQueryCache;
+    mutable SatQueryCache satQueryCache;
+
+public:
+    /// Statistics of path-condition queries
+    //@{
+    mutable u32_t numOfEquivQueries{0};		///< number of equivalence queries
+    mutable u32_t numOfSatQueries{0};			///< number of satisfiability queries
+    mutable u32_t numOfSyntacticAnswers{0};	///< queries answered by syntactic checks
+    mutable u32_t numOfCacheHits{0};			///< queries answered from the caches
+    mutable u32_t numOfSolverCalls{0};		///< queries sent to Z3
+    //@}
+
 protected:
     BBCondMap bbConds;						///< map basic block to its successors/predecessors branch conditions
 
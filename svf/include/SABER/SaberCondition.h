@@ -0,0 +1,172 @@
+//===- SaberCondition.h -- Path conditions of SABER-------------------------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013->  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+/*
+ * SaberCondition.h
+ *
+ * A path condition is either a Z3 expression (default) or a BDD (-saber-bdd).
+ * The backend is chosen once, when the first SaberCondAllocator is created,
+ * and all conditions of a run use the same backend.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: SVF team
+ */
+
+#ifndef INCLUDE_SABER_SABERCONDITION_H_
+#define INCLUDE_SABER_SABERCONDITION_H_
+
+#include "Util/Z3Expr.h"
+#include "Util/BDDExpr.h"
+
+namespace SVF
+{
+
+class SaberCondition
+{
+private:
+    Z3Expr z3Expr;
+    BDDExpr bddExpr;
+
+    static bool bddBackend;
+
+    /// Shared null Z3 expression, so that BDD conditions do not create Z3 terms
+    static const Z3Expr& nullZ3Expr();
+
+public:
+    /// The null condition of the selected backend
+    SaberCondition() : z3Expr(nullZ3Expr())
+    {
+    }
+
+    SaberCondition(const Z3Expr& e) : z3Expr(e)
+    {
+    }
+
+    SaberCondition(const BDDExpr& e) : z3Expr(nullZ3Expr()), bddExpr(e)
+    {
+    }
+
+    /// Select the backend, which must be done before any condition is created
+    static inline void setBDDBackend(bool bdd)
+    {
+        bddBackend = bdd;
+    }
+    static inline bool isBDDBackend()
+    {
+        return bddBackend;
+    }
+
+    /// Get id, unique for each live condition of the selected backend
+    inline u32_t id() const
+    {
+        return bddBackend ? bddExpr.id() : z3Expr.id();
+    }
+
+    inline const Z3Expr& getZ3Expr() const
+    {
+        return z3Expr;
+    }
+    inline const z3::expr& getExpr() const
+    {
+        return z3Expr.getExpr();
+    }
+    inline const BDDExpr& getBDDExpr() const
+    {
+        return bddExpr;
+    }
+
+    /// Z3 context of the Z3 backend
+    static inline z3::context& getContext()
+    {
+        return Z3Expr::getContext();
+    }
+
+    /// null condition
+    static inline SaberCondition nullExpr()
+    {
+        return SaberCondition();
+    }
+
+    /// Return the unique true condition
+    static inline SaberCondition getTrueCond()
+    {
+        if (bddBackend)
+            return BDDExpr::getTrueCond();
+        return Z3Expr::getTrueCond();
+    }
+
+    /// Return the unique false condition
+    static inline SaberCondition getFalseCond()
+    {
+        if (bddBackend)
+            return BDDExpr::getFalseCond();
+        return Z3Expr::getFalseCond();
+    }
+
+    /// compute NEG
+    static inline SaberCondition NEG(const SaberCondition& cond)
+    {
+        if (bddBackend)
+            return BDDExpr::NEG(cond.bddExpr);
+        return Z3Expr::NEG(cond.z3Expr);
+    }
+
+    /// compute AND, used for branch condition
+    static inline SaberCondition AND(const SaberCondition& lhs, const SaberCondition& rhs)
+    {
+        if (bddBackend)
+            return BDDExpr::AND(lhs.bddExpr, rhs.bddExpr);
+        return Z3Expr::AND(lhs.z3Expr, rhs.z3Expr);
+    }
+
+    /// compute OR, used for branch condition
+    static inline SaberCondition OR(const SaberCondition& lhs, const SaberCondition& rhs)
+    {
+        if (bddBackend)
+            return BDDExpr::OR(lhs.bddExpr, rhs.bddExpr);
+        return Z3Expr::OR(lhs.z3Expr, rhs.z3Expr);
+    }
+
+    /// output a condition as a string
+    static inline std::string dumpStr(const SaberCondition& cond)
+    {
+        if (bddBackend)
+            return BDDExpr::dumpStr(cond.bddExpr);
+        return Z3Expr::dumpStr(cond.z3Expr);
+    }
+
+    friend std::ostream& operator<<(std::ostream& out, const SaberCondition& cond)
+    {
+        out << dumpStr(cond);
+        return out;
+    }
+
+    friend bool eq(const SaberCondition& lhs, const SaberCondition& rhs)
+    {
+        if (bddBackend)
+            return eq(lhs.bddExpr, rhs.bddExpr);
+        return eq(lhs.z3Expr, rhs.z3Expr);
+    }
+};
+
+} // End namespace SVF
+
+#endif /* INCLUDE_SABER_SABERCONDITION_H_ */
@@ -72,6 +72,7 @@ private:
     std::unique_ptr<SaberCondAllocator> saberCondAllocator;
     SVFGNodeToDPItemsMap nodeToDPItemsMap;	///<  record forward visited dpitems
     SVFGNodeSet visitedSet;	///<  record backward visited nodes
+    double guardTime;	///<  time spent computing and solving path guards
 
 protected:
     SaberSVFGBuilder memSSA;
@@ -81,7 +82,7 @@ protected:
 public:
 
     /// Constructor
-    SrcSnkDDA() : _curSlice(nullptr), svfg(nullptr), ptaCallGraph(nullptr)
+    SrcSnkDDA() : _curSlice(nullptr), guardTime(0), svfg(nullptr), ptaCallGraph(nullptr)
     {
         saberCondAllocator = std::make_unique<SaberCondAllocator>();
     }
@@ -110,10 +111,7 @@ public:
     virtual void initialize(SVFModule* module);
 
     /// Finalize analysis
-    virtual void finalize()
-    {
-        dumpSlices();
-    }
+    virtual void finalize();
 
     /// Get SVFIR
     SVFIR* getPAG() const
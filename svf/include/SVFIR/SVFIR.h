@@ -31,6 +31,8 @@
 #define INCLUDE_SVFIR_H_
 
 #include "Graphs/IRGraph.h"
+#include <functional>
+#include <mutex>
 
 namespace SVF
 {
@@ -69,6 +71,7 @@ public:
     typedef Map<NodeLocationSet,NodeID> NodeLocationSetMap;
     typedef Map<const SVFValue*, NodeLocationSetMap> GepValueVarMap;
     typedef Map<NodePair,NodeID> NodePairSetMap;
+    typedef std::function<void(const SVFFunction*)> FunctionMaterializer;
 
 private:
     /// ValueNodes - This map indicates the Node that a particular SVFValue* is
@@ -94,6 +97,9 @@ private:
     ICFG* icfg; // ICFG
     CommonCHGraph* chgraph; // class hierarchy graph
     CallSiteSet callSiteSet; /// all the callsites of a program
+    FunctionMaterializer funMaterializer; ///< Build the ICFG nodes and SVFStmts of a function on demand (-lazy-svfir)
+    Set<const SVFFunction*> materializedFuns; ///< Functions whose ICFG nodes and SVFStmts have been built lazily
+    std::mutex materializeMutex; ///< Serialise lazy materialization requested by different analyses/threads
     /// Constructor
     SVFIR(bool buildFromFile);
 
@@ -135,6 +141,27 @@ public:
     /// Initialize candidate pointers
     void initialiseCandidatePointers();
 
+    /// Lazy SVFIR construction (-lazy-svfir)
+    /// The front end registers a materializer building the ICFG nodes and SVFStmts of one function;
+    /// analyses call materialize* before they traverse the SVFIR/ICFG.
+    //@{
+    inline void setFunctionMaterializer(FunctionMaterializer materializer)
+    {
+        funMaterializer = materializer;
+    }
+    inline bool isLazilyBuilt() const
+    {
+        return funMaterializer != nullptr;
+    }
+    bool isMaterialized(const SVFFunction* fun);
+    /// Build a single function (thread-safe, idempotent)
+    void materializeFunction(const SVFFunction* fun);
+    /// Build the functions reachable from the program entry and all address-taken functions
+    void materializeReachableFunctions();
+    /// Build every function of the module
+    void materializeAllFunctions();
+    //@}
+
     /// Destructor
     virtual ~SVFIR()
     {
@@ -33,6 +33,8 @@
 #include "SVFIR/SVFType.h"
 #include "Graphs/GraphPrinter.h"
 #include "Util/Casting.h"
+#include "Util/StringPool.h"
+#include <functional>
 
 namespace SVF
 {
@@ -176,14 +178,21 @@ private:
     bool ptrInUncalledFun;  ///< true if this pointer is in an uncalled function
     bool constDataOrAggData;    ///< true if this value is a ConstantData (e.g., numbers, string, floats) or a constantAggregate
 
+public:
+    /// Computes the source code information of a value on demand (registered by a front end, e.g., LLVMModuleSet)
+    typedef std::function<std::string(const SVFValue*)> SourceLocResolver;
+
+private:
+    static SourceLocResolver sourceLocResolver;
+
 protected:
     const SVFType* type;   ///< Type of this SVFValue
-    std::string name;       ///< Short name of this value for debugging
-    std::string sourceLoc;  ///< Source code information of this value
+    const std::string* name;       ///< Short name of this value for debugging (interned in StringPool)
+    mutable const std::string* sourceLoc;  ///< Source code information of this value (interned, resolved on first access)
     /// Constructor
     SVFValue(const std::string& val, const SVFType* ty, SVFValKind k): kind(k),
         ptrInUncalledFun(false), constDataOrAggData(SVFConstData==k), type(ty),
-        name(val), sourceLoc("No source code Info")
+        name(&StringPool::intern(val)), sourceLoc(nullptr)
     {
     }
 
@@ -207,9 +216,9 @@ public:
         return kind;
     }
 
-    inline virtual const std::string getName() const
+    inline virtual const std::string& getName() const
     {
-        return name;
+        return *name;
     }
 
     inline virtual const SVFType* getType() const
@@ -234,12 +243,22 @@ public:
     }
     inline virtual void setSourceLoc(const std::string& sourceCodeInfo)
     {
-        sourceLoc = sourceCodeInfo;
+        sourceLoc = &StringPool::intern(sourceCodeInfo);
     }
-    inline virtual const std::string getSourceLoc() const
+    /// Source code information, computed by the registered resolver the first time it is requested
+    virtual const std::string& getSourceLoc() const;
+
+    /// Set/Clear the front-end callback computing source code information lazily
+    //@{
+    static inline void setSourceLocResolver(SourceLocResolver resolver)
+    {
+        sourceLocResolver = resolver;
+    }
+    static inline void clearSourceLocResolver()
     {
-        return sourceLoc;
+        sourceLocResolver = nullptr;
     }
+    //@}
 
     /// Needs to be implemented by a specific SVF front end (e.g., the implementation in LLVMUtil)
     virtual const std::string toString() const;
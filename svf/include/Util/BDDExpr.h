@@ -0,0 +1,314 @@
+//===- BDDExpr.h -- Binary decision diagram conditions----------------------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013->  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+/*
+ * BDDExpr.h
+ *
+ * A small reduced ordered binary decision diagram (ROBDD) package.
+ *
+ * Nodes are hash-consed through a unique table, so two BDDs denote the same
+ * boolean function if and only if they are the same node: equivalence and
+ * satisfiability are constant time. AND/OR/NEG results are memoised in an
+ * operation cache. Nodes are reference counted by BDDExpr handles and dead
+ * nodes are reclaimed by a mark-and-sweep garbage collection which only runs
+ * between top-level operations.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: SVF team
+ */
+
+#ifndef INCLUDE_UTIL_BDDEXPR_H_
+#define INCLUDE_UTIL_BDDEXPR_H_
+
+#include "SVFIR/SVFType.h"
+
+namespace SVF
+{
+
+class BDDManager
+{
+    friend class BDDExpr;
+
+public:
+    typedef u32_t NodeIndex;
+
+    static const NodeIndex FalseNode = 0;
+    static const NodeIndex TrueNode = 1;
+    static const NodeIndex NullNode = 0xffffffff;    ///< "no condition", never an operand
+    static const u32_t TerminalVar = 0xffffffff;     ///< variable of the two terminals, below all variables
+
+private:
+    struct Node
+    {
+        u32_t var;
+        NodeIndex low;      ///< cofactor when var is false
+        NodeIndex high;     ///< cofactor when var is true
+        u32_t refs;         ///< number of BDDExpr handles pointing to this node
+    };
+
+    struct NodeKey
+    {
+        u32_t var;
+        NodeIndex low;
+        NodeIndex high;
+        inline bool operator==(const NodeKey& rhs) const
+        {
+            return var == rhs.var && low == rhs.low && high == rhs.high;
+        }
+    };
+    struct NodeKeyHash
+    {
+        inline size_t operator()(const NodeKey& k) const
+        {
+            size_t h = k.var;
+            h = h * 0x9e3779b97f4a7c15ULL + k.low;
+            h = h * 0x9e3779b97f4a7c15ULL + k.high;
+            return h ^ (h >> 29);
+        }
+    };
+    typedef Map<NodeKey, NodeIndex, NodeKeyHash> UniqueTable;
+
+    enum Operator
+    {
+        OpNone, OpAnd, OpOr, OpNeg
+    };
+    /// A direct-mapped operation cache entry
+    struct CacheEntry
+    {
+        u32_t op;
+        NodeIndex lhs;
+        NodeIndex rhs;
+        NodeIndex res;
+    };
+
+    std::vector<Node> nodes;
+    std::vector<NodeIndex> freeNodes;
+    UniqueTable uniqueTable;
+    std::vector<CacheEntry> opCache;
+    u32_t gcThreshold;
+
+    BDDManager();
+
+public:
+    /// Statistics
+    //@{
+    u32_t numOfLiveNodes;
+    u32_t peakLiveNodes;
+    u32_t numOfGCs;
+    u32_t numOfCacheHits;
+    u32_t numOfCacheLookups;
+    //@}
+
+    /// Singleton, all BDDExprs live in one manager
+    static BDDManager& getManager();
+
+    inline u32_t getVar(NodeIndex n) const
+    {
+        return nodes[n].var;
+    }
+    inline NodeIndex getLow(NodeIndex n) const
+    {
+        return nodes[n].low;
+    }
+    inline NodeIndex getHigh(NodeIndex n) const
+    {
+        return nodes[n].high;
+    }
+    inline bool isTerminal(NodeIndex n) const
+    {
+        return n == FalseNode || n == TrueNode;
+    }
+
+private:
+    inline void incRef(NodeIndex n)
+    {
+        if (n != NullNode && !isTerminal(n))
+            nodes[n].refs++;
+    }
+    inline void decRef(NodeIndex n)
+    {
+        if (n != NullNode && !isTerminal(n))
+        {
+            assert(nodes[n].refs > 0 && "BDD node reference count underflow");
+            nodes[n].refs--;
+        }
+    }
+
+    /// Return the unique node (var, low, high)
+    NodeIndex mkNode(u32_t var, NodeIndex low, NodeIndex high);
+
+    /// Top-level operations, which may trigger a garbage collection before they start
+    //@{
+    NodeIndex mkVar(u32_t var);
+    NodeIndex mkAnd(NodeIndex lhs, NodeIndex rhs);
+    NodeIndex mkOr(NodeIndex lhs, NodeIndex rhs);
+    NodeIndex mkNeg(NodeIndex n);
+    //@}
+
+    /// Recursive apply, never collects
+    //@{
+    NodeIndex apply(Operator op, NodeIndex lhs, NodeIndex rhs);
+    NodeIndex negate(NodeIndex n);
+    //@}
+
+    /// Operation cache
+    //@{
+    inline CacheEntry& cacheSlot(Operator op, NodeIndex lhs, NodeIndex rhs)
+    {
+        size_t h = (size_t) op * 0x9e3779b97f4a7c15ULL + lhs;
+        h = h * 0x9e3779b97f4a7c15ULL + rhs;
+        return opCache[(h ^ (h >> 32)) & (opCache.size() - 1)];
+    }
+    //@}
+
+    /// Reclaim the nodes unreachable from referenced nodes if the table has grown past gcThreshold
+    void collectIfNeeded();
+    void collect();
+};
+
+/*!
+ * A handle to a BDD node. The interface mirrors the boolean part of Z3Expr
+ * so that the two can be used interchangeably as path conditions.
+ */
+class BDDExpr
+{
+public:
+    typedef BDDManager::NodeIndex NodeIndex;
+
+private:
+    NodeIndex node;
+
+    explicit BDDExpr(NodeIndex n) : node(n)
+    {
+        BDDManager::getManager().incRef(node);
+    }
+
+public:
+    BDDExpr() : node(BDDManager::NullNode)
+    {
+    }
+
+    BDDExpr(const BDDExpr& rhs) : node(rhs.node)
+    {
+        BDDManager::getManager().incRef(node);
+    }
+
+    ~BDDExpr()
+    {
+        BDDManager::getManager().decRef(node);
+    }
+
+    inline BDDExpr& operator=(const BDDExpr& rhs)
+    {
+        if (node != rhs.node)
+        {
+            BDDManager::getManager().incRef(rhs.node);
+            BDDManager::getManager().decRef(node);
+            node = rhs.node;
+        }
+        return *this;
+    }
+
+    /// Get id, equal ids mean equivalent functions
+    inline u32_t id() const
+    {
+        return node;
+    }
+
+    inline bool isTrue() const
+    {
+        return node == BDDManager::TrueNode;
+    }
+    inline bool isFalse() const
+    {
+        return node == BDDManager::FalseNode;
+    }
+    inline bool isNull() const
+    {
+        return node == BDDManager::NullNode;
+    }
+
+    /// The boolean variable var
+    static inline BDDExpr var(u32_t v)
+    {
+        return BDDExpr(BDDManager::getManager().mkVar(v));
+    }
+
+    /// null expression
+    static inline BDDExpr nullExpr()
+    {
+        return BDDExpr();
+    }
+
+    /// Return the unique true condition
+    static inline BDDExpr getTrueCond()
+    {
+        return BDDExpr(BDDManager::TrueNode);
+    }
+
+    /// Return the unique false condition
+    static inline BDDExpr getFalseCond()
+    {
+        return BDDExpr(BDDManager::FalseNode);
+    }
+
+    /// compute NEG
+    static inline BDDExpr NEG(const BDDExpr& expr)
+    {
+        return BDDExpr(BDDManager::getManager().mkNeg(expr.node));
+    }
+
+    /// compute AND, used for branch condition
+    static inline BDDExpr AND(const BDDExpr& lhs, const BDDExpr& rhs)
+    {
+        return BDDExpr(BDDManager::getManager().mkAnd(lhs.node, rhs.node));
+    }
+
+    /// compute OR, used for branch condition
+    static inline BDDExpr OR(const BDDExpr& lhs, const BDDExpr& rhs)
+    {
+        return BDDExpr(BDDManager::getManager().mkOr(lhs.node, rhs.node));
+    }
+
+    /// Collect the literals (var, polarity) occurring on a path to true
+    void getSatLiterals(Set<std::pair<u32_t, bool>>& literals) const;
+
+    /// Number of nodes of this BDD
+    static u32_t getExprSize(const BDDExpr& expr);
+
+    /// output a BDD as a disjunction of its paths to true
+    static std::string dumpStr(const BDDExpr& expr);
+
+    friend std::ostream& operator<<(std::ostream& out, const BDDExpr& expr)
+    {
+        out << dumpStr(expr);
+        return out;
+    }
+
+    friend bool eq(const BDDExpr& lhs, const BDDExpr& rhs)
+    {
+        return lhs.node == rhs.node;
+    }
+};
+
+} // End namespace SVF
+
+#endif /* INCLUDE_UTIL_BDDEXPR_H_ */
@@ -0,0 +1,89 @@
+//===- MappedFile.h -- Read-only memory-mapped files ---------------------------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013->  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * MappedFile.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef INCLUDE_UTIL_MAPPEDFILE_H_
+#define INCLUDE_UTIL_MAPPEDFILE_H_
+
+#include "SVFIR/SVFType.h"
+#include <string>
+
+namespace SVF
+{
+
+/*!
+ * A read-only view of a whole file mapped into memory.
+ * Large inputs are read directly from the page cache instead of being
+ * copied line by line through iostreams.
+ */
+class MappedFile
+{
+public:
+    MappedFile() : buffer(nullptr), length(0)
+    {
+    }
+
+    ~MappedFile()
+    {
+        close();
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// Map fileName into memory, return false if it cannot be opened
+    bool open(const std::string& fileName);
+
+    /// Unmap the file
+    void close();
+
+    inline bool isOpen() const
+    {
+        return buffer != nullptr;
+    }
+
+    inline const char* data() const
+    {
+        return buffer;
+    }
+
+    inline size_t size() const
+    {
+        return length;
+    }
+
+    /// Split the file into (about) n chunks of whole lines, returned as [begin, end) offsets
+    std::vector<std::pair<size_t, size_t>> splitLines(u32_t n) const;
+
+private:
+    const char* buffer;
+    size_t length;
+};
+
+} // End namespace SVF
+
+#endif /* INCLUDE_UTIL_MAPPEDFILE_H_ */
@@ -12,6 +12,8 @@ namespace SVF
 
 // Forward declare for the Clusterer.
 class BVDataPTAImpl;
+// Forward declare for the Reorderer.
+class ConstraintGraph;
 
 /// Allocates node IDs for objects and values, upon request, according to
 /// some strategy which can be user-defined.
@@ -39,6 +41,20 @@ public:
         DEBUG,
     };
 
+    /// Graph-locality orderings used to renumber memory objects inside points-to sets
+    /// after the constraint graph has been built (see Reorderer).
+    enum Reordering
+    {
+        /// Keep the allocation order.
+        NO_REORDER,
+        /// Reverse Cuthill-McKee over the undirected constraint graph.
+        RCM,
+        /// Breadth-first traversal of each component, seeded in ID (i.e., program) order.
+        BFS,
+        /// Topological order of the strongly connected components of the constraint graph.
+        SCC_TOPO,
+    };
+
     /// These nodes, and any nodes before them are assumed allocated
     /// as objects and values. For simplicity's sake, numObjects and
     /// numVals thus start at 4 (and the other counters are set
@@ -118,6 +134,7 @@ public:
         static const std::string RegioningTime;
         static const std::string DistanceMatrixTime;
         static const std::string FastClusterTime;
+        static const std::string MinHashTime;
         static const std::string DendrogramTraversalTime;
         static const std::string EvalTime;
         static const std::string TotalTime;
@@ -175,6 +192,15 @@ public:
         /// at the top, which is the "last" (consider that it is 2D) element of the dendrogram, numObjects - 1.
         static inline void traverseDendrogram(std::vector<NodeID> &nodeMap, const int *dendrogram, const size_t numObjects, unsigned &allocCounter, Set<int> &visited, const int index, const std::vector<NodeID> &regionNodeMap);
 
+        /// Allocates the objects of a region (regionMapping maps 0 to n to them) consecutively
+        /// from allocCounter without a distance matrix. Objects are grouped by label
+        /// propagation over the objects and the points-to sets they occur in, seeded by
+        /// MinHash signatures of those occurrences, so objects that often co-occur get nearby
+        /// IDs. Linear in the total size of the region's points-to sets per round (plus sorting).
+        static inline void minHashOrder(std::vector<NodeID> &nodeMap, const std::vector<std::pair<const PointsTo *, unsigned>> &pointsToSets,
+                                        const std::vector<NodeID> &regionMapping, const Map<NodeID, unsigned> &regionReverseMapping,
+                                        unsigned &allocCounter);
+
         /// Returns a vector mapping object IDs to a label such that if two objects appear
         /// in the same points-to set, they have the same label. The "appear in the same
         /// points-to set" is encoded by graph which is an adjacency list ensuring that
@@ -187,6 +213,27 @@ public:
                     Map<PointsTo, unsigned> pointsToSets, const std::string &evalSubtitle, double &evalTime);
 
     };
+
+    /// Renumber memory objects following a locality ordering of the constraint graph,
+    /// so that objects flowing through nearby constraint nodes get nearby internal IDs.
+    /// Unlike the Clusterer, this needs no prior points-to information.
+    class Reorderer
+    {
+    public:
+        /// Returns a vector mapping every node ID up to the largest object ID to a new
+        /// ID. Objects are numbered first, in the order their constraint nodes (or the
+        /// pointers taking their address) are visited; remaining IDs follow in order.
+        /// IDs allocated later (e.g., GEP objects) are left unmapped.
+        static std::vector<NodeID> reorder(ConstraintGraph *consCG, Reordering ordering);
+
+    private:
+        /// Append the nodes of consCG to order following the respective traversal.
+        ///@{
+        static void bfsOrder(ConstraintGraph *consCG, std::vector<NodeID> &order);
+        static void rcmOrder(ConstraintGraph *consCG, std::vector<NodeID> &order);
+        static void sccOrder(ConstraintGraph *consCG, std::vector<NodeID> &order);
+        ///@}
+    };
 };
 
 }  // namespace SVF
@@ -6,6 +6,7 @@
 #include <sstream>
 #include "FastCluster/fastcluster.h"
 #include "Util/CommandLine.h"
+#include "Graphs/GraphExporter.h"
 #include "Util/PTAStat.h"
 #include "MemoryModel/PointerAnalysisImpl.h"
 #include "Util/NodeIDAllocator.h"
@@ -46,6 +47,9 @@ public:
     /// Use an explicitly plain mapping with flow-sensitive (not null).
     static const Option<bool> PlainMappingFs;
 
+    /// Renumber objects in points-to sets by a locality ordering of the constraint graph.
+    static const OptionMap<NodeIDAllocator::Reordering> NodeReorder;
+
     /// Type of points-to set to use for all analyses.
     static const OptionMap<PointsTo::Type> PtType;
 
@@ -68,9 +72,22 @@ public:
     /// PTData type.
     static const OptionMap<BVDataPTAImpl::PTBackingType> ptDataBacking;
 
+    /// Memory budget (MB) and spill file of the spilled PTData.
+    static const Option<u32_t> PtdBudget;
+    static const Option<std::string> PtdSpillFile;
+
+    /// Compact the final points-to sets of Andersen's and FS analyses into read-only storage.
+    static const Option<bool> FreezePts;
+
     /// Time limit for the main phase (i.e., the actual solving) of FS analyses.
     static const Option<u32_t> FsTimeLimit;
 
+    /// Anytime FS analyses: stop at the time/memory budget and fall back to Andersen's.
+    static const Option<bool> FsAnytime;
+
+    /// Memory budget (MB) for the main phase of anytime FS analyses.
+    static const Option<u32_t> FsMemLimit;
+
     /// Time limit for the Andersen's analyses.
     static const Option<u32_t> AnderTimeLimit;
 
@@ -117,9 +134,11 @@ public:
     static const Option<bool> ContextInsensitive;
     static const Option<bool> KeepAOFI;
     static const Option<std::string> SelfCycle;
+    static const Option<u32_t> MaxBypassGrowth;
 
     // Sparse value-flow graph (VFG.cpp)
     static const Option<bool> DumpVFG;
+    static const Option<u32_t> VFGBuildThreads;
 
     // Location set for modeling abstract memory object (LocationSet.cpp)
     static const Option<bool> SingleStride;
@@ -135,12 +154,16 @@ public:
     static const Option<bool> ShowSVFIRValue;
     static const Option<bool> DumpICFG;
     static const Option<bool> CallGraphDotGraph;
+    static const OptionMap<GraphFormat::Name> DumpGraphFormat;
+    static const Option<std::string> DumpGraphColumns;
+    static const Option<u32_t> DumpGraphThreads;
     static const Option<bool> PAGPrint;
     static const Option<u32_t> IndirectCallLimit;
     static const Option<bool> UsePreCompFieldSensitive;
     static const Option<bool> EnableAliasCheck;
     static const Option<bool> EnableThreadCallGraph;
     static const Option<bool> ConnectVCallOnCHA;
+    static const Option<bool> IncrementalCallGraph;
 
     // PointerAnalysisImpl.cpp
     static const Option<bool> INCDFPTData;
@@ -173,6 +196,7 @@ public:
     // MHP.cpp
     static const Option<bool> PrintInterLev;
     static const Option<bool> DoLockAnalysis;
+    static const Option<u32_t> MHPThreads;
 
     // MTA.cpp
     static const Option<bool> AndersenAnno;
@@ -222,6 +246,7 @@ public:
 
     // SaberCondAllocator.cpp
     static const Option<bool> PrintPathCond;
+    static const Option<bool> SaberBDD;
 
     // SVFUtil.cpp
     static const Option<bool> DisableWarn;
@@ -237,6 +262,8 @@ public:
     static const Option<bool> DiffPts;
     static Option<bool> DetectPWC;
     static const Option<bool> VtableInSVFIR;
+    static const Option<bool> LazySVFIR;
+    static const Option<bool> HVN;
 
     // WPAPass.cpp
     static const Option<bool> AnderSVFG;
@@ -245,6 +272,10 @@ public:
     static OptionMultiple<PointerAnalysis::PTATY> PASelected;
     static OptionMultiple<WPAPass::AliasCheckRule> AliasRule;
 
+    // AnalysisServer.cpp
+    static const Option<std::string> ServerSocket;
+    static const Option<u32_t> ServerThreads;
+
     // DOTGraphTraits
     static const Option<bool> ShowHiddenNode;
 
@@ -256,10 +287,16 @@ public:
     static const Option<bool>  PEGTransfer;
     static const Option<bool>  CFLSVFG;
     static const Option<bool> POCRAlias;
+    static const Option<u32_t> CFLSolverThreads;
+    static const Option<std::string> WriteCFLGraph;
 
     // Loop Analysis
     static const Option<bool> LoopAnalysis;
     static const Option<u32_t> LoopBound;
+
+    // Abstract Execution (AbstractExecution.cpp)
+    static const Option<u32_t> AEWidenDelay;
+    static const Option<u32_t> AENarrowingIters;
 };
 }  // namespace SVF
 
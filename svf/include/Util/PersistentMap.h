@@ -0,0 +1,547 @@
+//===- PersistentMap.h -- Persistent map over integer keys ----------------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013->  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * PersistentMap.h
+ *
+ * A persistent (copy-on-write) map from unsigned integer keys to values,
+ * implemented as a big-endian Patricia tree (Okasaki and Gill, "Fast
+ * Mergeable Integer Maps", ML Workshop 1998).
+ *
+ * Copying a map is O(1): both copies share the same tree and a node is only
+ * duplicated when one of them writes below it. Because a set of keys has a
+ * unique tree shape, merging two maps (unionWith/updateWith) and comparing
+ * them (equals) can return immediately on subtrees that are shared by
+ * pointer, which is what makes joins and widenings of two states that
+ * derive from a common ancestor cheap.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: SVF team
+ */
+
+#ifndef PERSISTENTMAP_H_
+#define PERSISTENTMAP_H_
+
+#include <cassert>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace SVF
+{
+
+/// Persistent map from Key (an unsigned integral type) to Value.
+/// Iteration visits keys in ascending order and yields
+/// std::pair<const Key, Value>, like std::map.
+///
+/// Mutation goes through operator[], insert, emplace, erase, transform and
+/// the merge operations. Nodes owned by this map only are updated in place,
+/// shared nodes are copied first, so a reference returned by operator[] stays
+/// valid until this map is copied or the key is erased.
+template <typename Key, typename Value>
+class PersistentMap
+{
+    static_assert(std::is_integral<Key>::value && std::is_unsigned<Key>::value,
+                  "PersistentMap keys must be unsigned integers");
+
+public:
+    typedef Key key_type;
+    typedef Value mapped_type;
+    typedef std::pair<const Key, Value> value_type;
+    typedef size_t size_type;
+
+private:
+    struct Node;
+    typedef std::shared_ptr<Node> NodePtr;
+
+    /// A node is a leaf iff left is null. For a leaf, prefix is the key.
+    /// For a branch, mask is the single branching bit and prefix holds the
+    /// key bits above it; keys with the bit clear go left.
+    struct Node
+    {
+        Key prefix;
+        Key mask;
+        size_type size;
+        NodePtr left;
+        NodePtr right;
+        std::unique_ptr<value_type> kv;
+
+        Node(const Key& k, const Value& v) : prefix(k), mask(0), size(1), kv(new value_type(k, v)) {}
+
+        Node(Key p, Key m, const NodePtr& l, const NodePtr& r)
+            : prefix(p), mask(m), size(l->size + r->size), left(l), right(r) {}
+
+        inline bool isLeaf() const
+        {
+            return left == nullptr;
+        }
+    };
+
+    NodePtr root;
+
+public:
+    /// Forward iterator over the leaves in ascending key order
+    class const_iterator
+    {
+        friend class PersistentMap;
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef typename PersistentMap::value_type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const value_type* pointer;
+        typedef const value_type& reference;
+
+        const_iterator() : cur(nullptr) {}
+
+        reference operator*() const
+        {
+            return *cur->kv;
+        }
+
+        pointer operator->() const
+        {
+            return cur->kv.get();
+        }
+
+        const_iterator& operator++()
+        {
+            if (pending.empty())
+                cur = nullptr;
+            else
+            {
+                const Node* n = pending.back();
+                pending.pop_back();
+                descend(n);
+            }
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            const_iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        bool operator==(const const_iterator& rhs) const
+        {
+            return cur == rhs.cur;
+        }
+
+        bool operator!=(const const_iterator& rhs) const
+        {
+            return cur != rhs.cur;
+        }
+
+    private:
+        const Node* cur;
+        std::vector<const Node*> pending;   ///< right subtrees still to visit
+
+        /// Move to the leftmost leaf of n
+        void descend(const Node* n)
+        {
+            while (!n->isLeaf())
+            {
+                pending.push_back(n->right.get());
+                n = n->left.get();
+            }
+            cur = n;
+        }
+    };
+    typedef const_iterator iterator;
+
+    PersistentMap() = default;
+
+    PersistentMap(std::initializer_list<value_type> init)
+    {
+        for (const value_type& kv : init)
+            insert(kv);
+    }
+
+    PersistentMap(const PersistentMap&) = default;
+    PersistentMap(PersistentMap&&) noexcept = default;
+    PersistentMap& operator=(const PersistentMap&) = default;
+    PersistentMap& operator=(PersistentMap&&) noexcept = default;
+
+    inline const_iterator begin() const
+    {
+        const_iterator it;
+        if (root)
+            it.descend(root.get());
+        return it;
+    }
+
+    inline const_iterator end() const
+    {
+        return const_iterator();
+    }
+
+    inline size_type size() const
+    {
+        return root ? root->size : 0;
+    }
+
+    inline bool empty() const
+    {
+        return root == nullptr;
+    }
+
+    inline void clear()
+    {
+        root.reset();
+    }
+
+    const_iterator find(Key k) const
+    {
+        const_iterator it;
+        const Node* n = root.get();
+        while (n && !n->isLeaf())
+        {
+            if (!matchPrefix(k, n->prefix, n->mask))
+                return end();
+            if (zeroBit(k, n->mask))
+            {
+                it.pending.push_back(n->right.get());
+                n = n->left.get();
+            }
+            else
+                n = n->right.get();
+        }
+        if (n == nullptr || n->prefix != k)
+            return end();
+        it.cur = n;
+        return it;
+    }
+
+    inline size_type count(Key k) const
+    {
+        return lookup(root.get(), k) ? 1 : 0;
+    }
+
+    const Value& at(Key k) const
+    {
+        const Value* v = lookup(root.get(), k);
+        assert(v && "key not in PersistentMap");
+        return *v;
+    }
+
+    /// Return the value of k, default-constructing it if absent
+    Value& operator[](Key k)
+    {
+        return getOrInsert(root, k);
+    }
+
+    /// Insert kv if its key is absent, return whether it was inserted
+    bool insert(const value_type& kv)
+    {
+        if (lookup(root.get(), kv.first))
+            return false;
+        getOrInsert(root, kv.first) = kv.second;
+        return true;
+    }
+
+    inline bool emplace(Key k, const Value& v)
+    {
+        return insert(value_type(k, v));
+    }
+
+    size_type erase(Key k)
+    {
+        if (!lookup(root.get(), k))
+            return 0;
+        root = remove(root, k);
+        return 1;
+    }
+
+    /// Apply f(Value&) to every value
+    template <typename F>
+    void transform(F f)
+    {
+        root = mapNode(root, f);
+    }
+
+    /// Union with other. For keys in both maps f(mine, theirs) updates this
+    /// map's value, keys only in other are copied in. f must be idempotent
+    /// (f(v, v) leaves v unchanged) as shared subtrees are skipped.
+    template <typename F>
+    void unionWith(const PersistentMap& other, F f)
+    {
+        root = merge(root, other.root, f, true);
+    }
+
+    /// For keys in both maps apply f(mine, theirs), leave everything else
+    /// untouched. f must be idempotent, as for unionWith.
+    template <typename F>
+    void updateWith(const PersistentMap& other, F f)
+    {
+        root = merge(root, other.root, f, false);
+    }
+
+    /// Whether both maps have the same keys and eq holds for every pair of values
+    template <typename Eq>
+    bool equals(const PersistentMap& other, Eq eq) const
+    {
+        return equalNodes(root.get(), other.root.get(), eq);
+    }
+
+    /// Whether the two maps share the same tree (and are therefore equal)
+    inline bool sharesWith(const PersistentMap& other) const
+    {
+        return root == other.root;
+    }
+
+private:
+    static inline bool zeroBit(Key k, Key m)
+    {
+        return (k & m) == 0;
+    }
+
+    /// The bits of k above the branching bit m
+    static inline Key maskBits(Key k, Key m)
+    {
+        return k & ~(m | (m - 1));
+    }
+
+    static inline bool matchPrefix(Key k, Key p, Key m)
+    {
+        return maskBits(k, m) == p;
+    }
+
+    static inline Key highestBit(Key x)
+    {
+        assert(x != 0 && "no bit set");
+        return (Key) (1ULL << (63 - __builtin_clzll((unsigned long long) x)));
+    }
+
+    static inline Key branchingBit(Key p0, Key p1)
+    {
+        return highestBit(p0 ^ p1);
+    }
+
+    static NodePtr makeLeaf(Key k, const Value& v)
+    {
+        return std::make_shared<Node>(k, v);
+    }
+
+    static NodePtr makeBranch(Key p, Key m, const NodePtr& l, const NodePtr& r)
+    {
+        return std::make_shared<Node>(p, m, l, r);
+    }
+
+    /// Branch joining two trees with disjoint prefixes p0 and p1
+    static NodePtr join(Key p0, const NodePtr& t0, Key p1, const NodePtr& t1)
+    {
+        Key m = branchingBit(p0, p1);
+        if (zeroBit(p0, m))
+            return makeBranch(maskBits(p0, m), m, t0, t1);
+        else
+            return makeBranch(maskBits(p0, m), m, t1, t0);
+    }
+
+    /// Branch with l/r as children, reusing n if they did not change
+    static NodePtr rebuild(const NodePtr& n, const NodePtr& l, const NodePtr& r)
+    {
+        if (!l)
+            return r;
+        if (!r)
+            return l;
+        if (l == n->left && r == n->right)
+            return n;
+        return makeBranch(n->prefix, n->mask, l, r);
+    }
+
+    static const Value* lookup(const Node* n, Key k)
+    {
+        while (n && !n->isLeaf())
+        {
+            if (!matchPrefix(k, n->prefix, n->mask))
+                return nullptr;
+            n = zeroBit(k, n->mask) ? n->left.get() : n->right.get();
+        }
+        if (n && n->prefix == k)
+            return &n->kv->second;
+        return nullptr;
+    }
+
+    /// Copy-on-write descent: shared nodes on the path to k are duplicated
+    static Value& getOrInsert(NodePtr& slot, Key k)
+    {
+        if (!slot)
+        {
+            slot = makeLeaf(k, Value());
+            return slot->kv->second;
+        }
+        Node* n = slot.get();
+        if (n->isLeaf())
+        {
+            if (n->prefix == k)
+            {
+                if (slot.use_count() > 1)
+                    slot = makeLeaf(k, n->kv->second);
+                return slot->kv->second;
+            }
+            NodePtr leaf = makeLeaf(k, Value());
+            slot = join(k, leaf, n->prefix, slot);
+            return leaf->kv->second;
+        }
+        if (!matchPrefix(k, n->prefix, n->mask))
+        {
+            NodePtr leaf = makeLeaf(k, Value());
+            slot = join(k, leaf, n->prefix, slot);
+            return leaf->kv->second;
+        }
+        if (slot.use_count() > 1)
+            slot = makeBranch(n->prefix, n->mask, n->left, n->right);
+        n = slot.get();
+        Value& v = getOrInsert(zeroBit(k, n->mask) ? n->left : n->right, k);
+        n->size = n->left->size + n->right->size;
+        return v;
+    }
+
+    /// Functional removal of an existing key
+    static NodePtr remove(const NodePtr& n, Key k)
+    {
+        if (n->isLeaf())
+            return nullptr;
+        if (zeroBit(k, n->mask))
+            return rebuild(n, remove(n->left, k), n->right);
+        else
+            return rebuild(n, n->left, remove(n->right, k));
+    }
+
+    /// Functional insertion of leaf, replacing any leaf with the same key
+    static NodePtr insertLeaf(const NodePtr& n, const NodePtr& leaf)
+    {
+        Key k = leaf->prefix;
+        if (!n)
+            return leaf;
+        if (n->isLeaf())
+            return n->prefix == k ? leaf : join(k, leaf, n->prefix, n);
+        if (!matchPrefix(k, n->prefix, n->mask))
+            return join(k, leaf, n->prefix, n);
+        if (zeroBit(k, n->mask))
+            return rebuild(n, insertLeaf(n->left, leaf), n->right);
+        else
+            return rebuild(n, n->left, insertLeaf(n->right, leaf));
+    }
+
+    template <typename F>
+    static NodePtr mapNode(const NodePtr& n, F& f)
+    {
+        if (!n)
+            return n;
+        if (n->isLeaf())
+        {
+            NodePtr leaf = makeLeaf(n->prefix, n->kv->second);
+            f(leaf->kv->second);
+            return leaf;
+        }
+        return makeBranch(n->prefix, n->mask, mapNode(n->left, f), mapNode(n->right, f));
+    }
+
+    /// Leaf for the key of s merged with theirs
+    template <typename F>
+    static NodePtr mergeLeaf(const NodePtr& s, const Value& theirs, F& f)
+    {
+        NodePtr leaf = makeLeaf(s->prefix, s->kv->second);
+        f(leaf->kv->second, theirs);
+        return leaf;
+    }
+
+    template <typename F>
+    static NodePtr merge(const NodePtr& s, const NodePtr& t, F& f, bool addMissing)
+    {
+        if (s == t || !t)
+            return s;
+        if (!s)
+            return addMissing ? t : s;
+
+        if (s->isLeaf())
+        {
+            const Value* theirs = lookup(t.get(), s->prefix);
+            if (!addMissing)
+                return theirs ? mergeLeaf(s, *theirs, f) : s;
+            return insertLeaf(t, theirs ? mergeLeaf(s, *theirs, f) : s);
+        }
+        if (t->isLeaf())
+        {
+            const Value* mine = lookup(s.get(), t->prefix);
+            if (mine)
+            {
+                NodePtr leaf = makeLeaf(t->prefix, *mine);
+                f(leaf->kv->second, t->kv->second);
+                return insertLeaf(s, leaf);
+            }
+            return addMissing ? insertLeaf(s, t) : s;
+        }
+
+        if (s->mask == t->mask && s->prefix == t->prefix)
+            return rebuild(s, merge(s->left, t->left, f, addMissing), merge(s->right, t->right, f, addMissing));
+
+        /// s has the shorter prefix: t lies within one of s's subtrees
+        if (s->mask > t->mask && matchPrefix(t->prefix, s->prefix, s->mask))
+        {
+            if (zeroBit(t->prefix, s->mask))
+                return rebuild(s, merge(s->left, t, f, addMissing), s->right);
+            else
+                return rebuild(s, s->left, merge(s->right, t, f, addMissing));
+        }
+
+        /// t has the shorter prefix: s lies within one of t's subtrees
+        if (t->mask > s->mask && matchPrefix(s->prefix, t->prefix, t->mask))
+        {
+            if (zeroBit(s->prefix, t->mask))
+            {
+                NodePtr l = merge(s, t->left, f, addMissing);
+                return addMissing ? rebuild(t, l, t->right) : l;
+            }
+            else
+            {
+                NodePtr r = merge(s, t->right, f, addMissing);
+                return addMissing ? rebuild(t, t->left, r) : r;
+            }
+        }
+
+        /// Disjoint prefixes
+        return addMissing ? join(s->prefix, s, t->prefix, t) : s;
+    }
+
+    template <typename Eq>
+    static bool equalNodes(const Node* a, const Node* b, Eq& eq)
+    {
+        if (a == b)
+            return true;
+        if (!a || !b || a->size != b->size || a->prefix != b->prefix || a->mask != b->mask)
+            return false;
+        if (a->isLeaf())
+            return b->isLeaf() && eq(a->kv->second, b->kv->second);
+        return !b->isLeaf() && equalNodes(a->left.get(), b->left.get(), eq) &&
+               equalNodes(a->right.get(), b->right.get(), eq);
+    }
+};
+
+} // End namespace SVF
+
+#endif /* PERSISTENTMAP_H_ */
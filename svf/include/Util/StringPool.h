@@ -0,0 +1,34 @@
+//===- StringPool.h -- Interned strings shared by SVF values ------------------//
+
+#ifndef STRINGPOOL_H_
+#define STRINGPOOL_H_
+
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+namespace SVF
+{
+
+/// Keeps a single immutable copy of every distinct string handed to it.
+/// Names and source locations of SVFValues are stored as pointers into this
+/// pool so that repeated names (e.g., "retval", "this.addr", "") share storage
+/// and accessors can return references instead of copies.
+/// References returned by intern stay valid for the lifetime of the program.
+class StringPool
+{
+public:
+    /// Return the pooled copy of str (thread-safe)
+    static const std::string& intern(const std::string& str);
+
+    /// Number of distinct strings in the pool
+    static size_t size();
+
+private:
+    static std::unordered_set<std::string>& getPool();
+    static std::mutex& getMutex();
+};
+
+} // End namespace SVF
+
+#endif /* STRINGPOOL_H_ */
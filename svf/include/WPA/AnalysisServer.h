@@ -0,0 +1,138 @@
+//===- AnalysisServer.h -- Resident query server for pointer analysis results-//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013-2017>  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+
+/*
+ * AnalysisServer.h
+ *
+ * Keeps the SVFIR, a solved pointer analysis and (optionally) its SVFG in
+ * memory and answers queries over a Unix-domain socket, so that clients asking
+ * many small questions do not pay for loading and solving every time.
+ *
+ * The protocol is line-delimited JSON: one request object per line, one
+ * response object per line, in order on each connection. Every response
+ * echoes the request's "id" (if any). Failed requests get an "error" string.
+ *
+ *   {"id":1,"query":"pts","var":12}             -> {"id":1,"pts":[3,7]}
+ *   {"id":2,"query":"alias","var1":12,"var2":15} -> {"id":2,"alias":"MayAlias"}
+ *   {"id":3,"query":"callees","function":"main"} -> {"id":3,"callees":["foo"]}
+ *   {"id":4,"query":"callees","callsite":42}     -> (callsite is a call ICFG node ID)
+ *   {"id":5,"query":"callers","function":"foo"}  -> {"id":5,"callers":["main"]}
+ *   {"id":6,"query":"reach","src":5,"dst":9}     -> {"id":6,"reachable":true}
+ *                                                  (SVFG node IDs; needs an SVFG)
+ *   {"id":7,"query":"stats"}                     -> request count, latency, throughput
+ *   {"id":8,"query":"shutdown"}                  -> stops the server
+ *
+ * Connections are served concurrently by a fixed pool of worker threads. The
+ * results are only read, which is safe without locking once the points-to
+ * sets are frozen (-freeze-pts); otherwise queries are serialised.
+ */
+
+#ifndef INCLUDE_WPA_ANALYSISSERVER_H_
+#define INCLUDE_WPA_ANALYSISSERVER_H_
+
+#include "MemoryModel/PointerAnalysisImpl.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+typedef struct cJSON cJSON;
+
+namespace SVF
+{
+
+class SVFG;
+
+class AnalysisServer
+{
+public:
+    /// svfg may be null, in which case reachability queries are rejected.
+    AnalysisServer(BVDataPTAImpl* pta, SVFG* svfg);
+
+    /// Listens on socketPath and serves connections with numThreads workers
+    /// until a shutdown request arrives. Returns false if the socket cannot be set up.
+    bool serve(const std::string& socketPath, u32_t numThreads);
+
+    /// Answers one request line; exposed so the protocol can be driven without a socket.
+    std::string handleRequest(const std::string& line);
+
+    /// Prints request count, latency and throughput.
+    void printStat() const;
+
+private:
+    BVDataPTAImpl* pta;
+    SVFIR* pag;
+    SVFG* svfg;
+
+    /// Serialises queries when the points-to sets are not frozen.
+    bool serialise;
+    std::mutex queryMutex;
+
+    /// Accepted connections waiting for a worker.
+    ///@{
+    std::deque<int> pendingConns;
+    Set<int> activeConns;
+    std::mutex connMutex;
+    std::condition_variable connCond;
+    ///@}
+
+    int listenFd;
+    std::atomic<bool> stopping;
+
+    /// Statistics.
+    ///@{
+    std::chrono::steady_clock::time_point startTime;
+    std::atomic<u64_t> numRequests;
+    std::atomic<u64_t> numErrors;
+    std::atomic<u64_t> totalLatencyNs;
+    std::atomic<u64_t> maxLatencyNs;
+    ///@}
+
+    /// Makes sure concurrent queries never insert into SVFIR's lazily filled maps.
+    void prepareForQueries();
+
+    void workerLoop();
+    void serveConnection(int fd);
+    void requestShutdown();
+
+    /// Query handlers, adding their results to response. Return an error message, or "" on success.
+    ///@{
+    std::string answer(const cJSON* request, cJSON* response);
+    std::string answerPts(const cJSON* request, cJSON* response);
+    std::string answerAlias(const cJSON* request, cJSON* response);
+    std::string answerCallees(const cJSON* request, cJSON* response);
+    std::string answerCallers(const cJSON* request, cJSON* response);
+    std::string answerReach(const cJSON* request, cJSON* response);
+    void answerStats(cJSON* response) const;
+    ///@}
+
+    /// Reads a non-negative integer field of request into id; returns false if missing or malformed.
+    static bool getIdField(const cJSON* request, const char* field, NodeID& id);
+
+    void recordLatency(u64_t latencyNs, bool failed);
+};
+
+} // End namespace SVF
+
+#endif /* INCLUDE_WPA_ANALYSISSERVER_H_ */
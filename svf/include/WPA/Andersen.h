@@ -94,6 +94,8 @@ public:
                  || pta->getAnalysisTy() == AndersenWaveDiff_WPA
                  || pta->getAnalysisTy() == AndersenSCD_WPA
                  || pta->getAnalysisTy() == AndersenSFR_WPA
+                 || pta->getAnalysisTy() == AndersenLCD_WPA
+                 || pta->getAnalysisTy() == AndersenHCD_WPA
                  || pta->getAnalysisTy() == TypeCPP_WPA
                  || pta->getAnalysisTy() == Steensgaard_WPA);
     }
@@ -137,6 +139,10 @@ public:
     static double timeOfProcessCopyGep;
     static double timeOfProcessLoadStore;
     static double timeOfUpdateCallGraph;
+    static u32_t numOfHCDMerges;       /// Number of nodes merged by hybrid cycle detection
+    static u32_t numOfHVNMergedNodes;  /// Number of nodes merged by offline variable substitution
+    static u32_t numOfHVNRemovedEdges; /// Number of edges removed by offline variable substitution
+    static double timeOfHVN;
     //@}
 
 protected:
@@ -193,7 +199,9 @@ public:
         return (pta->getAnalysisTy() == Andersen_WPA
                 || pta->getAnalysisTy() == AndersenWaveDiff_WPA
                 || pta->getAnalysisTy() == AndersenSCD_WPA
-                || pta->getAnalysisTy() == AndersenSFR_WPA);
+                || pta->getAnalysisTy() == AndersenSFR_WPA
+                || pta->getAnalysisTy() == AndersenLCD_WPA
+                || pta->getAnalysisTy() == AndersenHCD_WPA);
     }
     //@}
 
@@ -284,6 +292,9 @@ protected:
     //@{
     void processAllAddr();
 
+    /// handleCopyGep and handleLoadStore call processCopy, processGep,
+    /// processLoad and processStore statically; a subclass overriding one of
+    /// them also overrides the handle method that calls it (see AndersenLCD).
     virtual bool processLoad(NodeID node, const ConstraintEdge* load);
     virtual bool processStore(NodeID node, const ConstraintEdge* load);
     virtual bool processCopy(NodeID node, const ConstraintEdge* edge);
@@ -294,6 +305,24 @@ protected:
     virtual bool processGepPts(const PointsTo& pts, const GepCGEdge* edge);
     //@}
 
+    /// Propagate the diff points-to set of node along its copy and gep edges.
+    /// The copy handler is a template parameter so the per-edge call is
+    /// resolved at compile time and the loop only walks contiguous records.
+    template<typename CopyHandler>
+    inline void propagateDiffPts(ConstraintNode* node, CopyHandler handleCopy)
+    {
+        NodeID nodeId = node->getId();
+        computeDiffPts(nodeId);
+
+        if (!getDiffPts(nodeId).empty())
+        {
+            for (const ConstraintNode::EdgeRecord& copy : node->getCopyOutRecords())
+                handleCopy(nodeId, copy.edge);
+            for (const ConstraintNode::EdgeRecord& gep : node->getGepOutRecords())
+                Andersen::processGep(nodeId, SVFUtil::cast<GepCGEdge>(gep.edge));
+        }
+    }
+
     /// Add copy edge on constraint graph
     virtual inline bool addCopyEdge(NodeID src, NodeID dst)
     {
@@ -321,6 +350,13 @@ protected:
     void mergeSccNodes(NodeID repNodeId, const NodeBS& subNodes);
     void mergeSccCycle();
     //@}
+
+    /// Offline variable substitution (hash-based value numbering), merging
+    /// pointer-equivalent nodes before the first iteration
+    //@{
+    void mergeOfflineEquivalentNodes();
+    void collectIndirectNodes(NodeBS& indirectNodes);
+    //@}
     /// Collapse a field object into its base for field insensitive anlaysis
     //@{
     virtual void collapsePWCNode(NodeID nodeId);
@@ -334,6 +370,8 @@ protected:
 
     /// SCC detection
     virtual NodeStack& SCCDetect();
+    /// SCC detection only visiting what is reachable from candidates
+    virtual NodeStack& SCCDetect(NodeSet& candidates);
 
 
 
@@ -368,6 +406,10 @@ protected:
     /// Runs a Steensgaard analysis and performs clustering based on those
     /// results set the global best mapping.
     virtual void cluster(void) const;
+
+    /// Renumbers objects by a locality ordering of the constraint graph
+    /// (-node-reorder) and sets the global best mapping.
+    virtual void reorder(void);
 };
 
 
@@ -409,6 +451,26 @@ public:
     virtual void postProcessNode(NodeID nodeId);
     virtual bool handleLoad(NodeID id, const ConstraintEdge* load);
     virtual bool handleStore(NodeID id, const ConstraintEdge* store);
+
+protected:
+    /// Record the source of a new copy edge as a root of the next wave
+    inline bool addCopyEdge(NodeID src, NodeID dst) override
+    {
+        if (!Andersen::addCopyEdge(src, dst))
+            return false;
+        waveCandidates.insert(src);
+        return true;
+    }
+
+    /// Collapsing fields changes points-to sets anywhere, so the next wave is a full one
+    void collapseFields() override;
+
+private:
+    /// Sources of the copy edges added since the last wave. Once the first wave
+    /// has run, only nodes reachable from them can gain new points-to targets.
+    NodeSet waveCandidates;
+    /// Whether the next wave has to visit the whole constraint graph.
+    bool fullWave = true;
 };
 
 } // End namespace SVF
@@ -0,0 +1,142 @@
+//===- AndersenLCD.h -- Lazy and hybrid cycle detection Andersen's analysis--//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013->  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * AndersenLCD.h
+ *
+ * Lazy cycle detection (LCD) and hybrid cycle detection (HCD), following
+ * "The Ant and the Grasshopper: Fast and Accurate Pointer Analysis for
+ * Millions of Lines of Code" (Hardekopf and Lin, PLDI'07).
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: SVF team
+ */
+
+#ifndef INCLUDE_WPA_ANDERSENLCD_H_
+#define INCLUDE_WPA_ANDERSENLCD_H_
+
+#include "WPA/Andersen.h"
+
+namespace SVF
+{
+
+/*!
+ * Lazy Cycle Detection Based Andersen Analysis
+ *
+ * No whole-graph SCC detection is performed. A cycle search is started from
+ * the destination of a copy edge only when propagating along the edge does
+ * not change anything and both ends have the same points-to set, which is
+ * what a copy cycle looks like once it has converged. Each edge triggers at
+ * most one search.
+ */
+class AndersenLCD : public Andersen
+{
+protected:
+    NodeSet lcdCandidates;
+    NodePairSet checkedEdges;
+
+public:
+    AndersenLCD(SVFIR* _pag, PTATY type = AndersenLCD_WPA) :
+        Andersen(_pag, type)
+    {
+    }
+
+    /// Methods for support type inquiry through isa, cast, and dyn_cast:
+    //@{
+    static inline bool classof(const AndersenLCD *)
+    {
+        return true;
+    }
+    static inline bool classof(const PointerAnalysis *pta)
+    {
+        return (pta->getAnalysisTy() == AndersenLCD_WPA
+                || pta->getAnalysisTy() == AndersenHCD_WPA);
+    }
+    //@}
+
+    /// Get PTA name
+    virtual const std::string PTAName() const
+    {
+        return "AndersenLCD";
+    }
+
+protected:
+    virtual void processNode(NodeID nodeId);
+    virtual void handleCopyGep(ConstraintNode* node);
+    virtual bool processCopy(NodeID node, const ConstraintEdge* edge);
+    virtual NodeStack& SCCDetect();
+};
+
+/*!
+ * Hybrid Cycle Detection Based Andersen Analysis
+ *
+ * An offline pass finds the SCCs of the constraint graph extended with a
+ * "ref" node *p per pointer p (p --load--> q gives *p -> q, and
+ * q --store--> p gives q -> *p). A cycle through *a and a non-ref node b
+ * becomes a real cycle through every object pointed to by a, so when a is
+ * processed online its pointees are merged with b without searching.
+ * Cycles the offline pass cannot see are left to lazy cycle detection.
+ */
+class AndersenHCD : public AndersenLCD
+{
+private:
+    Map<NodeID, NodeID> hcdTargets;	///< a -> b, where *a and b are in one offline SCC
+
+public:
+    AndersenHCD(SVFIR* _pag, PTATY type = AndersenHCD_WPA) :
+        AndersenLCD(_pag, type)
+    {
+    }
+
+    /// Methods for support type inquiry through isa, cast, and dyn_cast:
+    //@{
+    static inline bool classof(const AndersenHCD *)
+    {
+        return true;
+    }
+    static inline bool classof(const PointerAnalysis *pta)
+    {
+        return pta->getAnalysisTy() == AndersenHCD_WPA;
+    }
+    //@}
+
+    /// Initialize analysis
+    virtual void initialize();
+
+    /// Get PTA name
+    virtual const std::string PTAName() const
+    {
+        return "AndersenHCD";
+    }
+
+protected:
+    virtual void processNode(NodeID nodeId);
+    virtual void mergeNodeToRep(NodeID nodeId, NodeID newRepId);
+
+private:
+    /// Offline SCC detection on the graph with ref nodes
+    void offlineCycleDetect();
+};
+
+} // End namespace SVF
+
+#endif /* INCLUDE_WPA_ANDERSENLCD_H_ */
@@ -69,6 +69,9 @@ public:
         numOfProcessedPhi = numOfProcessedActualParam = numOfProcessedFormalRet = 0;
         numOfProcessedMSSANode = 0;
         maxSCCSize = numOfSCC = numOfNodesInSCC = 0;
+        numOfRefinablePtrs = numOfFallbackPtrs = 0;
+        budgetExhausted = false;
+        budgetDeadline = 0;
         iterationForPrintStat = OnTheFlyIterBudgetForStat;
     }
 
@@ -230,6 +233,20 @@ protected:
     virtual void updateConnectedNodes(const SVFGEdgeSetTy& edges);
     //@}
 
+    /// Anytime analysis
+    //@{
+    /// Solve the worklist until it is empty or the budget is exhausted.
+    void solveWorklist() override;
+    /// Return TRUE if the time or memory budget of anytime analysis is exhausted.
+    bool isBudgetExhausted() const;
+    /// Collect the SVFG nodes whose results may still change had the analysis run to the end.
+    virtual void collectUnconvergedNodes(NodeBS& unconverged);
+    /// Add to nodes everything reachable from them on the SVFG.
+    void addReachableNodes(NodeBS& nodes) const;
+    /// Use Andersen's points-to sets for the pointers defined at unconverged nodes.
+    void fallBackToAndersen();
+    //@}
+
     /// Return TRUE if this is a strong update STORE statement.
     bool isStrongUpdate(const SVFGNode* node, NodeID& singleton);
 
@@ -291,6 +308,11 @@ protected:
     u32_t numOfSCC;
     u32_t numOfNodesInSCC;
 
+    u32_t numOfRefinablePtrs;	///< Number of pointers defined on the SVFG
+    u32_t numOfFallbackPtrs;	///< Number of pointers using Andersen's results
+    bool budgetExhausted;	///< Whether anytime analysis stopped early
+    double budgetDeadline;	///< Clock (ms) at which the time budget runs out
+
     double solveTime;	///< time of solve.
     double sccTime;	///< time of SCC detection.
     double processTime;	///< time of processNode.
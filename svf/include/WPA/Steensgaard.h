@@ -22,9 +22,6 @@ class Steensgaard:  public AndersenBase
 
 public:
 
-    typedef Map<NodeID, NodeID> NodeToEquivClassMap;
-    typedef Map<NodeID, Set<NodeID>> NodeToSubsMap;
-
     /// Constructor
     Steensgaard(SVFIR* _pag)
         :  AndersenBase(_pag, Steensgaard_WPA, true)
@@ -55,6 +52,11 @@ public:
 
     void ecUnion(NodeID id, NodeID ec);
 
+    /// Resolve indirect calls on the fly, unifying actual and formal parameters
+    virtual bool updateCallGraph(const CallSiteToFunPtrMap& callsites) override;
+
+    void connectCaller2CalleeParams(CallSite cs, const SVFFunction* F);
+
     /// Methods for support type inquiry through isa, cast, and dyn_cast:
     //@{
     static inline bool classof(const Steensgaard *)
@@ -91,33 +93,46 @@ public:
     }
 
     /// API for equivalence class operations
-    /// Every constraint node maps to an unique equivalence class EC
-    /// An equivalence class has a set of sub constraint nodes.
+    /// Every constraint node maps to an unique equivalence class EC, the root of
+    /// its union-find tree (union by rank, path halving on lookups).
+    /// An equivalence class has a set of sub constraint nodes, kept as a circular list.
     inline NodeID getEC(NodeID id) const
     {
-        NodeToEquivClassMap::const_iterator it = nodeToECMap.find(id);
-        if(it==nodeToECMap.end())
+        if (id >= ecParent.size())
             return id;
-        else
-            return it->second;
+        while (ecParent[id] != id)
+        {
+            ecParent[id] = ecParent[ecParent[id]];
+            id = ecParent[id];
+        }
+        return id;
     }
-    void setEC(NodeID node, NodeID rep);
+    /// Merge the ECs of node and rep, return the representative of the merged EC
+    NodeID setEC(NodeID node, NodeID rep);
 
-    inline Set<NodeID>& getSubNodes(NodeID id)
+    /// The next sub node in the EC of id, id itself if it is alone in its EC
+    inline NodeID getNextSubNode(NodeID id) const
     {
-        nodeToSubsMap[id].insert(id);
-        return nodeToSubsMap[id];
+        return id < ecNext.size() ? ecNext[id] : id;
     }
-    inline void addSubNode(NodeID node, NodeID sub)
+    /// All sub nodes in the EC of id
+    NodeBS getSubNodes(NodeID id) const;
+
+    /// Number of merges of two ECs
+    inline u32_t getNumOfECUnions() const
     {
-        nodeToSubsMap[node].insert(sub);
+        return numOfECUnions;
     }
 
 private:
+    /// Make id a singleton EC if it is not in the union-find arrays yet
+    void ensureEC(NodeID id);
 
     static Steensgaard* steens; // static instance
-    NodeToEquivClassMap nodeToECMap;
-    NodeToSubsMap nodeToSubsMap;
+    mutable std::vector<NodeID> ecParent;   ///< union-find parent, a root is the representative of its EC
+    std::vector<u32_t> ecRank;              ///< union-find rank of roots
+    std::vector<NodeID> ecNext;             ///< next sub node of the same EC (circular list)
+    u32_t numOfECUnions{0};
 };
 
 } /// end of the namespace
@@ -101,6 +101,8 @@ protected:
     virtual bool processStore(const StoreSVFGNode* store) override;
     virtual void processNode(NodeID n) override;
     virtual void updateConnectedNodes(const SVFGEdgeSetTy& newEdges) override;
+    /// Memory no longer flows along SVFG edges, so follow it through objects too.
+    virtual void collectUnconvergedNodes(NodeBS& unconverged) override;
 
     /// Override to do nothing. Instead, we will use propagateVersion when necessary.
     virtual bool propAlongIndirectEdge(const IndirectSVFGEdge*) override
@@ -204,11 +206,16 @@ private:
     // up those for o' instead.
     Map<NodeID, NodeID> equivalentObject;
 
-    /// Worklist for performing meld labeling, takes SVFG node l.
-    /// Nodes are added when the version they yield is changed.
-    FIFOWorkList<NodeID> vWorklist;
+    /// Nodes given a prelabel + the Andersen's points-to set of interest so we don't keep
+    /// calling getPts. For Store nodes, we'll fill that in, for MR nodes, we won't as its
+    /// getPointsTo is cheap.
+    std::vector<std::pair<const SVFGNode *, const PointsTo *>> prelabeledNodes;
 
-    Set<NodeID> prelabeledObjects;
+    /// Objects given a prelabel.
+    std::vector<NodeID> prelabeledObjects;
+    /// startingNodes[i] are the prelabeled nodes which prelabeled prelabeledObjects[i],
+    /// i.e., where meld labeling of that object starts.
+    std::vector<std::vector<const SVFGNode *>> startingNodes;
 
     /// Points-to DS for working with versions.
     BVDataPTAImpl::VersionedPTDataTy *vPtD;
@@ -38,6 +38,7 @@
 #define WPA_H_
 
 #include "MemoryModel/PointerAnalysisImpl.h"
+#include "MSSA/SVFGBuilder.h"
 
 namespace SVF
 {
@@ -67,7 +68,7 @@ public:
     };
 
     /// Constructor needs TargetLibraryInfo to be passed to the AliasAnalysis
-    WPAPass()
+    WPAPass() : _pta(nullptr), _svfg(nullptr)
     {
 
     }
@@ -105,6 +106,18 @@ public:
         return "WPAPass";
     }
 
+    /// The last pointer analysis run, and the SVFG built on top of it with -svfg (-ander only)
+    //@{
+    inline PointerAnalysis* getPTA() const
+    {
+        return _pta;
+    }
+    inline SVFG* getSVFG() const
+    {
+        return _svfg;
+    }
+    //@}
+
 private:
     /// Create pointer analysis according to specified kind and analyze the module.
     void runPointerAnalysis(SVFIR* pag, u32_t kind);
@@ -112,6 +125,7 @@ private:
     PTAVector ptaVector;	///< all pointer analysis to be executed.
     PointerAnalysis* _pta;	///<  pointer analysis to be executed.
     SVFG* _svfg;  ///< svfg generated through -ander pointer analysis
+    std::unique_ptr<SVFGBuilder> svfgBuilder;  ///< owns _svfg
 };
 
 } // End namespace SVF
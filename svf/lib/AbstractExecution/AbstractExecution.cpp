@@ -0,0 +1,532 @@
+//===- AbstractExecution.cpp -- WTO-driven abstract interpretation--------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013->  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * AbstractExecution.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: SVF team
+ */
+
+#include "AbstractExecution/AbstractExecution.h"
+#include "Util/Options.h"
+#include "Util/SVFStat.h"
+
+#include <iomanip>
+
+using namespace SVF;
+using namespace SVFUtil;
+
+AbstractExecution::AbstractExecution() : svfir(nullptr), svfir2ExeState(nullptr), curCtx(nullptr), totalTime(0)
+{
+}
+
+AbstractExecution::~AbstractExecution()
+{
+    for (auto& item : funToInfo)
+    {
+        delete item.second.wto;
+        delete item.second.graph;
+    }
+    delete svfir2ExeState;
+}
+
+/*!
+ * Analyse main (or every function without callers) with an empty input state
+ */
+void AbstractExecution::runOnModule(SVFIR* ir)
+{
+    svfir = ir;
+    /// walks the ICFG of every reachable function, so materialize it first under -lazy-svfir
+    svfir->materializeReachableFunctions();
+    svfir2ExeState = new SVFIR2ItvExeState(svfir);
+
+    double start = SVFStat::getClk(true);
+    initGlobalState();
+
+    if (const SVFFunction* main = getProgEntryFunction(svfir->getModule()))
+    {
+        analyzeFunction(main, IntervalExeState());
+    }
+    else
+    {
+        ICFG* icfg = svfir->getICFG();
+        for (const SVFFunction* fun : svfir->getModule()->getFunctionSet())
+        {
+            if (fun->isDeclaration())
+                continue;
+            const FunEntryICFGNode* entry = icfg->getFunEntryICFGNode(fun);
+            bool hasCaller = false;
+            for (const ICFGEdge* edge : entry->getInEdges())
+            {
+                if (isa<CallCFGEdge>(edge))
+                {
+                    hasCaller = true;
+                    break;
+                }
+            }
+            if (!hasCaller)
+                analyzeFunction(fun, IntervalExeState());
+        }
+    }
+    totalTime = (SVFStat::getClk(true) - start) / TIMEINTERVAL;
+}
+
+void AbstractExecution::initGlobalState()
+{
+    svfir2ExeState->setEs(IntervalExeState());
+    for (const SVFStmt* stmt : svfir->getICFG()->getGlobalICFGNode()->getSVFStmts())
+        handleSVFStmt(stmt);
+    svfir2ExeState->moveToGlobal();
+}
+
+const AbstractExecution::FunctionInfo& AbstractExecution::getFunctionInfo(const SVFFunction* fun)
+{
+    auto it = funToInfo.find(fun);
+    if (it != funToInfo.end())
+        return it->second;
+
+    CFBasicBlockGBuilder builder(fun);
+    builder.build();
+    FunctionInfo& info = funToInfo[fun];
+    info.graph = builder.getCFBasicBlockGraph();
+    info.wto = new CFBasicBlockGWTO(info.graph->getCFBasicBlockNode(fun->getEntryBlock()));
+    return info;
+}
+
+/*!
+ * Analyse the body of fun on input, and return the exit state sliced down to
+ * the abstract memory and the function's return value
+ */
+IntervalExeState AbstractExecution::analyzeFunction(const SVFFunction* fun, const IntervalExeState& input)
+{
+    FunctionStat& stat = funToStat[fun];
+    stat.numOfAnalyses++;
+    double start = SVFStat::getClk();
+    callStack.insert(fun);
+    calleeTimes.push_back(0);
+
+    FunctionContext ctx;
+    ctx.fun = fun;
+    ctx.info = &getFunctionInfo(fun);
+    FunctionContext* callerCtx = curCtx;
+    curCtx = &ctx;
+
+    ICFG* icfg = svfir->getICFG();
+    svfir2ExeState->setEs(input);
+    for (const SVFStmt* stmt : icfg->getFunEntryICFGNode(fun)->getSVFStmts())
+        handleSVFStmt(stmt);
+    ctx.entryES = svfir2ExeState->getEs();
+
+    for (const CFBasicBlockGWTOComp* comp : *ctx.info->wto)
+        handleWTOComponent(comp);
+
+    /// All returns share the function exit node, whose phi merges the return values
+    IntervalExeState exitES;
+    bool reachable = false;
+    for (const auto& item : ctx.postES)
+    {
+        if (item.first->getOutEdges().empty() == false)
+            continue;
+        if (reachable)
+            exitES.joinWith(item.second);
+        else
+        {
+            exitES = item.second;
+            reachable = true;
+        }
+    }
+    if (!reachable)
+        exitES = ctx.entryES;
+    svfir2ExeState->setEs(exitES);
+    for (const SVFStmt* stmt : icfg->getFunExitICFGNode(fun)->getSVFStmts())
+        handleSVFStmt(stmt);
+
+    Set<NodeID> rets;
+    if (svfir->funHasRet(fun))
+        rets.insert(svfir->getFunRet(fun)->getId());
+    IntervalExeState summary = sliceState(svfir2ExeState->getEs(), rets);
+    funToExitES[fun] = summary;
+
+    curCtx = callerCtx;
+    callStack.erase(fun);
+    double elapsed = (SVFStat::getClk() - start) / TIMEINTERVAL;
+    stat.time += elapsed - calleeTimes.back();
+    calleeTimes.pop_back();
+    if (!calleeTimes.empty())
+        calleeTimes.back() += elapsed;
+    return summary;
+}
+
+void AbstractExecution::handleWTOComponent(const CFBasicBlockGWTOComp* comp)
+{
+    if (const CFBasicBlockGWTONode* node = dyn_cast<CFBasicBlockGWTONode>(comp))
+    {
+        IntervalExeState pre;
+        if (computePreState(node->node(), pre))
+            handleBlock(node->node(), pre);
+    }
+    else
+    {
+        handleCycle(cast<CFBasicBlockGWTOCycle>(comp));
+    }
+}
+
+/*!
+ * Iterate a cycle until its head is stable: plain joins for the first
+ * Options::AEWidenDelay() iterations, widening afterwards. The fixpoint is
+ * then refined by at most Options::AENarrowingIters() descending iterations.
+ */
+void AbstractExecution::handleCycle(const CFBasicBlockGWTOCycle* cycle)
+{
+    const CFBasicBlockNode* head = cycle->head();
+    FunctionStat& stat = funToStat[curCtx->fun];
+    IntervalExeState prev;
+    for (u32_t iter = 0;; ++iter)
+    {
+        IntervalExeState cur;
+        if (!computePreState(head, cur))
+            return;
+        if (iter > 0)
+        {
+            IntervalExeState next = prev;
+            next.joinWith(cur);
+            if (next == prev)
+                break;
+            if (iter >= Options::AEWidenDelay())
+            {
+                cur = prev.widening(next);
+                cur.joinWith(next);
+                stat.numOfWidenings++;
+            }
+            else
+                cur = next;
+        }
+        prev = cur;
+        handleBlock(head, prev);
+        for (const CFBasicBlockGWTOComp* comp : *cycle)
+            handleWTOComponent(comp);
+    }
+
+    for (u32_t iter = 0; iter < Options::AENarrowingIters(); ++iter)
+    {
+        IntervalExeState cur;
+        if (!computePreState(head, cur))
+            break;
+        IntervalExeState narrowed = prev.narrowing(cur);
+        if (narrowed == prev)
+            break;
+        stat.numOfNarrowings++;
+        prev = narrowed;
+        handleBlock(head, prev);
+        for (const CFBasicBlockGWTOComp* comp : *cycle)
+            handleWTOComponent(comp);
+    }
+}
+
+bool AbstractExecution::computePreState(const CFBasicBlockNode* node, IntervalExeState& pre) const
+{
+    bool reachable = false;
+    if (node->getSVFBasicBlock() == curCtx->fun->getEntryBlock())
+    {
+        pre = curCtx->entryES;
+        reachable = true;
+    }
+    for (const CFBasicBlockEdge* edge : node->getInEdges())
+    {
+        auto it = curCtx->postES.find(edge->getSrcNode());
+        if (it == curCtx->postES.end() || !isFeasibleEdge(edge->getSrcNode(), node, it->second))
+            continue;
+        if (reachable)
+            pre.joinWith(it->second);
+        else
+        {
+            pre = it->second;
+            reachable = true;
+        }
+    }
+    return reachable;
+}
+
+/*!
+ * An edge is infeasible only if its branch condition evaluates to a constant
+ * other than the edge's successor value (the default case of a switch is
+ * always considered feasible)
+ */
+bool AbstractExecution::isFeasibleEdge(const CFBasicBlockNode* src, const CFBasicBlockNode* dst, const IntervalExeState& es) const
+{
+    if (src->begin() == src->end())
+        return true;
+    const ICFGNode* last = *(src->end() - 1);
+    if (const CallICFGNode* callNode = dyn_cast<CallICFGNode>(last))
+        last = callNode->getRetICFGNode();
+
+    bool hasEdge = false;
+    for (const ICFGEdge* edge : last->getOutEdges())
+    {
+        const IntraCFGEdge* intraEdge = dyn_cast<IntraCFGEdge>(edge);
+        if (intraEdge == nullptr || intraEdge->getDstNode()->getBB() != dst->getSVFBasicBlock())
+            continue;
+        hasEdge = true;
+        if (intraEdge->getCondition() == nullptr || intraEdge->getSuccessorCondValue() == -1 ||
+                !svfir->hasValueNode(intraEdge->getCondition()))
+            return true;
+        NodeID cond = svfir->getValueNode(intraEdge->getCondition());
+        auto it = es.getVarToVal().find(cond);
+        if (it == es.getVarToVal().end())
+        {
+            it = IntervalExeState::globalES.getVarToVal().find(cond);
+            if (it == IntervalExeState::globalES.getVarToVal().end())
+                return true;
+        }
+        if (!it->second.is_numeral() || it->second.getNumeral() == intraEdge->getSuccessorCondValue())
+            return true;
+    }
+    return !hasEdge;
+}
+
+void AbstractExecution::handleBlock(const CFBasicBlockNode* node, const IntervalExeState& pre)
+{
+    funToStat[curCtx->fun].numOfIterations++;
+    svfir2ExeState->setEs(pre);
+    for (const ICFGNode* icfgNode : *node)
+        handleICFGNode(icfgNode);
+    curCtx->postES[node] = svfir2ExeState->getEs();
+}
+
+void AbstractExecution::handleICFGNode(const ICFGNode* node)
+{
+    if (const CallICFGNode* callNode = dyn_cast<CallICFGNode>(node))
+    {
+        handleCallSite(callNode);
+        return;
+    }
+    for (const SVFStmt* stmt : node->getSVFStmts())
+        handleSVFStmt(stmt);
+}
+
+/*!
+ * Bind the actual parameters, then apply the summary of every callee with a
+ * body. Each callee only receives its formals and the abstract memory;
+ * recursive calls are cut by havocking memory and the return value.
+ */
+void AbstractExecution::handleCallSite(const CallICFGNode* callNode)
+{
+    for (const SVFStmt* stmt : callNode->getSVFStmts())
+        handleSVFStmt(stmt);
+
+    IntervalExeState callerES = svfir2ExeState->getEs();
+    IntervalExeState calleeES;
+    bool hasCallee = false;
+    for (const ICFGEdge* edge : callNode->getOutEdges())
+    {
+        const CallCFGEdge* callEdge = dyn_cast<CallCFGEdge>(edge);
+        if (callEdge == nullptr)
+            continue;
+        const SVFFunction* callee = callEdge->getDstNode()->getFun();
+        if (callee->isDeclaration())
+            continue;
+
+        Set<NodeID> formals;
+        for (const CallPE* callPE : callEdge->getCallPEs())
+            formals.insert(callPE->getLHSVarID());
+        IntervalExeState input = sliceState(callerES, formals);
+
+        IntervalExeState output;
+        if (callStack.find(callee) != callStack.end())
+        {
+            output = sliceState(callerES, Set<NodeID>());
+            havocMemory(output);
+            if (svfir->funHasRet(callee))
+                output[svfir->getFunRet(callee)->getId()] = IntervalValue::top();
+        }
+        else if (const IntervalExeState* summary = getSummary(callee, input))
+        {
+            funToStat[callee].numOfSummaryHits++;
+            output = *summary;
+        }
+        else
+        {
+            output = analyzeFunction(callee, input);
+            addSummary(callee, input, output);
+        }
+
+        if (hasCallee)
+            calleeES.joinWith(output);
+        else
+        {
+            calleeES = output;
+            hasCallee = true;
+        }
+    }
+
+    svfir2ExeState->setEs(callerES);
+    IntervalExeState& es = svfir2ExeState->getEs();
+    if (hasCallee)
+    {
+        /// Callees see the whole memory, so their exit memory replaces the caller's
+        es._locToItvVal = calleeES._locToItvVal;
+        es._locToVAddrs = calleeES._locToVAddrs;
+        es._varToItvVal.unionWith(calleeES._varToItvVal, [](IntervalValue& lhs, const IntervalValue& rhs)
+        {
+            lhs = rhs;
+        });
+        es._varToVAddrs.unionWith(calleeES._varToVAddrs, [](AddressValue& lhs, const AddressValue& rhs)
+        {
+            lhs = rhs;
+        });
+    }
+
+    for (const SVFStmt* stmt : callNode->getRetICFGNode()->getSVFStmts())
+        handleSVFStmt(stmt);
+
+    /// The result of an external or unresolved call is unknown
+    const SVFInstruction* cs = callNode->getCallSite();
+    if (svfir->hasValueNode(cs))
+    {
+        NodeID res = svfir->getValueNode(cs);
+        if (!es.inVarToIValTable(res) && !es.inVarToAddrsTable(res))
+            es[res] = IntervalValue::top();
+    }
+}
+
+void AbstractExecution::handleSVFStmt(const SVFStmt* stmt)
+{
+    if (const AddrStmt* addr = dyn_cast<AddrStmt>(stmt))
+        svfir2ExeState->translateAddr(addr);
+    else if (const BinaryOPStmt* binary = dyn_cast<BinaryOPStmt>(stmt))
+        svfir2ExeState->translateBinary(binary);
+    else if (const CmpStmt* cmp = dyn_cast<CmpStmt>(stmt))
+        svfir2ExeState->translateCmp(cmp);
+    else if (const LoadStmt* load = dyn_cast<LoadStmt>(stmt))
+        svfir2ExeState->translateLoad(load);
+    else if (const StoreStmt* store = dyn_cast<StoreStmt>(stmt))
+        svfir2ExeState->translateStore(store);
+    else if (const CopyStmt* copy = dyn_cast<CopyStmt>(stmt))
+        svfir2ExeState->translateCopy(copy);
+    else if (const GepStmt* gep = dyn_cast<GepStmt>(stmt))
+        svfir2ExeState->translateGep(gep);
+    else if (const SelectStmt* select = dyn_cast<SelectStmt>(stmt))
+        svfir2ExeState->translateSelect(select);
+    else if (const PhiStmt* phi = dyn_cast<PhiStmt>(stmt))
+        svfir2ExeState->translatePhi(phi);
+    else if (const CallPE* callPE = dyn_cast<CallPE>(stmt))
+        svfir2ExeState->translateCall(callPE);
+    else if (const RetPE* retPE = dyn_cast<RetPE>(stmt))
+        svfir2ExeState->translateRet(retPE);
+}
+
+IntervalExeState AbstractExecution::sliceState(const IntervalExeState& es, const Set<NodeID>& vars) const
+{
+    IntervalExeState sliced;
+    sliced._locToItvVal = es._locToItvVal;
+    sliced._locToVAddrs = es._locToVAddrs;
+    for (NodeID id : vars)
+    {
+        auto itvIt = es._varToItvVal.find(id);
+        if (itvIt != es._varToItvVal.end())
+            sliced._varToItvVal[id] = itvIt->second;
+        auto addrIt = es._varToVAddrs.find(id);
+        if (addrIt != es._varToVAddrs.end())
+            sliced._varToVAddrs[id] = addrIt->second;
+    }
+    return sliced;
+}
+
+void AbstractExecution::havocMemory(IntervalExeState& es) const
+{
+    es._locToItvVal.transform([](IntervalValue& val)
+    {
+        val.set_to_top();
+    });
+}
+
+/*!
+ * IntervalExeState::hash() only covers the keys of a state, so summaries are
+ * bucketed by a hash over the values as well and confirmed with operator==
+ */
+static u32_t hashInput(const IntervalExeState& es)
+{
+    size_t h = es.hash();
+    std::hash<double> hd;
+    for (const auto& item : es.getVarToVal())
+        h ^= hd(item.second.lb().getNumeral()) + hd(item.second.ub().getNumeral()) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    for (const auto& item : es.getLocToVal())
+        h ^= hd(item.second.lb().getNumeral()) + hd(item.second.ub().getNumeral()) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    return (u32_t) h;
+}
+
+const IntervalExeState* AbstractExecution::getSummary(const SVFFunction* fun, const IntervalExeState& input) const
+{
+    auto funIt = funToSummaries.find(fun);
+    if (funIt == funToSummaries.end())
+        return nullptr;
+    auto it = funIt->second.find(hashInput(input));
+    if (it == funIt->second.end())
+        return nullptr;
+    for (const Summary& summary : it->second)
+    {
+        if (summary.input == input)
+            return &summary.output;
+    }
+    return nullptr;
+}
+
+void AbstractExecution::addSummary(const SVFFunction* fun, const IntervalExeState& input, const IntervalExeState& output)
+{
+    funToSummaries[fun][hashInput(input)].push_back(Summary{input, output});
+}
+
+void AbstractExecution::printStat() const
+{
+    std::string moduleName(svfir->getModule()->getModuleIdentifier());
+    std::vector<std::string> names = SVFUtil::split(moduleName, '/');
+    if (names.size() > 1)
+        moduleName = names[names.size() - 1];
+
+    SVFUtil::outs() << "\n*********Abstract Execution Stat***************\n";
+    SVFUtil::outs() << "################ (program : " << moduleName << ")###############\n";
+    SVFUtil::outs().flags(std::ios::left);
+    unsigned field_width = 20;
+    SVFUtil::outs() << std::setw(40) << "Function" << std::setw(12) << "Analyses" << std::setw(12) << "Iterations"
+                    << std::setw(12) << "Widenings" << std::setw(12) << "Narrowings" << std::setw(12) << "SumHits"
+                    << "Time\n";
+    u32_t analyses = 0, iterations = 0, hits = 0;
+    for (const auto& item : funToStat)
+    {
+        const FunctionStat& stat = item.second;
+        SVFUtil::outs() << std::setw(40) << item.first->getName() << std::setw(12) << stat.numOfAnalyses
+                        << std::setw(12) << stat.numOfIterations << std::setw(12) << stat.numOfWidenings
+                        << std::setw(12) << stat.numOfNarrowings << std::setw(12) << stat.numOfSummaryHits
+                        << stat.time << "\n";
+        analyses += stat.numOfAnalyses;
+        iterations += stat.numOfIterations;
+        hits += stat.numOfSummaryHits;
+    }
+    SVFUtil::outs() << "-------------------------------------------------------\n";
+    SVFUtil::outs() << std::setw(field_width) << "AnalysedFuns" << funToStat.size() << "\n";
+    SVFUtil::outs() << std::setw(field_width) << "FunAnalyses" << analyses << "\n";
+    SVFUtil::outs() << std::setw(field_width) << "BBIterations" << iterations << "\n";
+    SVFUtil::outs() << std::setw(field_width) << "SummaryHits" << hits << "\n";
+    SVFUtil::outs() << std::setw(field_width) << "TotalTime" << totalTime << "\n";
+    SVFUtil::outs() << "#######################################################" << std::endl;
+}
@@ -39,55 +39,23 @@ bool ExeState::operator==(const ExeState &rhs) const
 
 void ExeState::joinWith(const ExeState &other)
 {
-    for (auto it = other._varToVAddrs.begin(); it != other._varToVAddrs.end(); ++it)
+    auto join = [](VAddrs &lhs, const VAddrs &rhs)
     {
-        auto key = it->first;
-        auto oit = _varToVAddrs.find(key);
-        if (oit != _varToVAddrs.end())
-        {
-            oit->second.join_with(it->second);
-        }
-        else
-        {
-            _varToVAddrs.emplace(key, it->second);
-        }
-    }
-    for (auto it = other._locToVAddrs.begin(); it != other._locToVAddrs.end(); ++it)
-    {
-        auto key = it->first;
-        auto oit = _locToVAddrs.find(key);
-        if (oit != _locToVAddrs.end())
-        {
-            oit->second.join_with(it->second);
-        }
-        else
-        {
-            _locToVAddrs.emplace(key, it->second);
-        }
-    }
+        lhs.join_with(rhs);
+    };
+    _varToVAddrs.unionWith(other._varToVAddrs, join);
+    _locToVAddrs.unionWith(other._locToVAddrs, join);
 }
 
 
 void ExeState::meetWith(const ExeState &other)
 {
-    for (auto it = other._varToVAddrs.begin(); it != other._varToVAddrs.end(); ++it)
+    auto meet = [](VAddrs &lhs, const VAddrs &rhs)
     {
-        auto key = it->first;
-        auto oit = _varToVAddrs.find(key);
-        if (oit != _varToVAddrs.end())
-        {
-            oit->second.meet_with(it->second);
-        }
-    }
-    for (auto it = other._locToVAddrs.begin(); it != other._locToVAddrs.end(); ++it)
-    {
-        auto key = it->first;
-        auto oit = _locToVAddrs.find(key);
-        if (oit != _locToVAddrs.end())
-        {
-            oit->second.meet_with(it->second);
-        }
-    }
+        lhs.meet_with(rhs);
+    };
+    _varToVAddrs.updateWith(other._varToVAddrs, meet);
+    _locToVAddrs.updateWith(other._locToVAddrs, meet);
 }
 
 u32_t ExeState::hash() const
@@ -59,36 +59,14 @@ u32_t IntervalExeState::hash() const
 IntervalExeState IntervalExeState::widening(const IntervalExeState& other)
 {
     IntervalExeState es = *this;
-    for (auto it = es._varToItvVal.begin(); it != es._varToItvVal.end(); ++it)
-    {
-        auto key = it->first;
-        if (other._varToItvVal.find(key) != other._varToItvVal.end())
-            it->second.widen_with(other._varToItvVal.at(key));
-    }
-    for (auto it = es._locToItvVal.begin(); it != es._locToItvVal.end(); ++it)
-    {
-        auto key = it->first;
-        if (other._locToItvVal.find(key) != other._locToItvVal.end())
-            it->second.widen_with(other._locToItvVal.at(key));
-    }
+    es.widenWith(other);
     return es;
 }
 
 IntervalExeState IntervalExeState::narrowing(const IntervalExeState& other)
 {
     IntervalExeState es = *this;
-    for (auto it = es._varToItvVal.begin(); it != es._varToItvVal.end(); ++it)
-    {
-        auto key = it->first;
-        if (other._varToItvVal.find(key) != other._varToItvVal.end())
-            it->second.narrow_with(other._varToItvVal.at(key));
-    }
-    for (auto it = es._locToItvVal.begin(); it != es._locToItvVal.end(); ++it)
-    {
-        auto key = it->first;
-        if (other._locToItvVal.find(key) != other._locToItvVal.end())
-            it->second.narrow_with(other._locToItvVal.at(key));
-    }
+    es.narrowWith(other);
     return es;
 
 }
@@ -96,93 +74,47 @@ IntervalExeState IntervalExeState::narrowing(const IntervalExeState& other)
 /// domain widen with other, important! other widen this.
 void IntervalExeState::widenWith(const IntervalExeState& other)
 {
-    for (auto it = _varToItvVal.begin(); it != _varToItvVal.end(); ++it)
+    auto widen = [](IntervalValue &lhs, const IntervalValue &rhs)
     {
-        auto key = it->first;
-        if (other.getVarToVal().find(key) != other.getVarToVal().end())
-            it->second.widen_with(other._varToItvVal.at(key));
-    }
-    for (auto it = _locToItvVal.begin(); it != _locToItvVal.end(); ++it)
-    {
-        auto key = it->first;
-        if (other._locToItvVal.find(key) != other._locToItvVal.end())
-            it->second.widen_with(other._locToItvVal.at(key));
-    }
+        lhs.widen_with(rhs);
+    };
+    _varToItvVal.updateWith(other._varToItvVal, widen);
+    _locToItvVal.updateWith(other._locToItvVal, widen);
 }
 
 /// domain join with other, important! other widen this.
 void IntervalExeState::joinWith(const IntervalExeState& other)
 {
     ExeState::joinWith(other);
-    for (auto it = other._varToItvVal.begin(); it != other._varToItvVal.end(); ++it)
-    {
-        auto key = it->first;
-        auto oit = _varToItvVal.find(key);
-        if (oit != _varToItvVal.end())
-        {
-            oit->second.join_with(it->second);
-        }
-        else
-        {
-            _varToItvVal.emplace(key, it->second);
-        }
-    }
-    for (auto it = other._locToItvVal.begin(); it != other._locToItvVal.end(); ++it)
+    auto join = [](IntervalValue &lhs, const IntervalValue &rhs)
     {
-        auto key = it->first;
-        auto oit = _locToItvVal.find(key);
-        if (oit != _locToItvVal.end())
-        {
-            oit->second.join_with(it->second);
-        }
-        else
-        {
-            _locToItvVal.emplace(key, it->second);
-        }
-    }
+        lhs.join_with(rhs);
+    };
+    _varToItvVal.unionWith(other._varToItvVal, join);
+    _locToItvVal.unionWith(other._locToItvVal, join);
 }
 
 /// domain narrow with other, important! other widen this.
 void IntervalExeState::narrowWith(const IntervalExeState& other)
 {
-    for (auto it = _varToItvVal.begin(); it != _varToItvVal.end(); ++it)
-    {
-        auto key = it->first;
-        auto oit = other.getVarToVal().find(key);
-        if (oit != other.getVarToVal().end())
-            it->second.narrow_with(oit->second);
-    }
-    for (auto it = _locToItvVal.begin(); it != _locToItvVal.end(); ++it)
+    auto narrow = [](IntervalValue &lhs, const IntervalValue &rhs)
     {
-        auto key = it->first;
-        auto oit = other._locToItvVal.find(key);
-        if (oit != other._locToItvVal.end())
-            it->second.narrow_with(oit->second);
-    }
+        lhs.narrow_with(rhs);
+    };
+    _varToItvVal.updateWith(other._varToItvVal, narrow);
+    _locToItvVal.updateWith(other._locToItvVal, narrow);
 }
 
 /// domain meet with other, important! other widen this.
 void IntervalExeState::meetWith(const IntervalExeState& other)
 {
     ExeState::meetWith(other);
-    for (auto it = other._varToItvVal.begin(); it != other._varToItvVal.end(); ++it)
-    {
-        auto key = it->first;
-        auto oit = _varToItvVal.find(key);
-        if (oit != _varToItvVal.end())
-        {
-            oit->second.meet_with(it->second);
-        }
-    }
-    for (auto it = other._locToItvVal.begin(); it != other._locToItvVal.end(); ++it)
+    auto meet = [](IntervalValue &lhs, const IntervalValue &rhs)
     {
-        auto key = it->first;
-        auto oit = _locToItvVal.find(key);
-        if (oit != _locToItvVal.end())
-        {
-            oit->second.meet_with(it->second);
-        }
-    }
+        lhs.meet_with(rhs);
+    };
+    _varToItvVal.updateWith(other._varToItvVal, meet);
+    _locToItvVal.updateWith(other._locToItvVal, meet);
 }
 
 /// Print values of all expressions
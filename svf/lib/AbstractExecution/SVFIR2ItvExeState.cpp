@@ -35,22 +35,19 @@ using namespace SVFUtil;
 
 void SVFIR2ItvExeState::applySummary(IntervalExeState &es)
 {
-    for (const auto &item: es._varToItvVal)
-    {
-        _es._varToItvVal[item.first] = item.second;
-    }
-    for (const auto &item: es._locToItvVal)
-    {
-        _es._locToItvVal[item.first] = item.second;
-    }
-    for (const auto &item: es._varToVAddrs)
-    {
-        _es._varToVAddrs[item.first] = item.second;
-    }
-    for (const auto &item: es._locToVAddrs)
-    {
-        _es._locToVAddrs[item.first] = item.second;
-    }
+    /// values of es override those of _es, shared subtrees are skipped
+    auto overwrite = [](IntervalValue &lhs, const IntervalValue &rhs)
+    {
+        lhs = rhs;
+    };
+    auto overwriteAddrs = [](VAddrs &lhs, const VAddrs &rhs)
+    {
+        lhs = rhs;
+    };
+    _es._varToItvVal.unionWith(es._varToItvVal, overwrite);
+    _es._locToItvVal.unionWith(es._locToItvVal, overwrite);
+    _es._varToVAddrs.unionWith(es._varToVAddrs, overwriteAddrs);
+    _es._locToVAddrs.unionWith(es._locToVAddrs, overwriteAddrs);
 }
 
 void SVFIR2ItvExeState::moveToGlobal()
@@ -275,6 +272,22 @@ void SVFIR2ItvExeState::initSVFVar(u32_t varId)
 
 void SVFIR2ItvExeState::translateAddr(const AddrStmt *addr)
 {
+    /// numeric constants all point to the constant object, keep their values instead
+    const SVFVar *lhs = addr->getLHSVar();
+    if (lhs->hasValue())
+    {
+        if (const SVFConstantInt *consInt = SVFUtil::dyn_cast<SVFConstantInt>(lhs->getValue()))
+        {
+            double numeral = (double)consInt->getSExtValue();
+            IntervalExeState::globalES[addr->getLHSVarID()] = IntervalValue(numeral, numeral);
+            return;
+        }
+        else if (const SVFConstantFP *consFP = SVFUtil::dyn_cast<SVFConstantFP>(lhs->getValue()))
+        {
+            IntervalExeState::globalES[addr->getLHSVarID()] = IntervalValue(consFP->getFPValue(), consFP->getFPValue());
+            return;
+        }
+    }
     initSVFVar(addr->getRHSVarID());
     if (inVarToIValTable(addr->getRHSVarID()))
     {
@@ -202,11 +202,12 @@ void CFLAlias::initialize()
 
     // Initialize sovler
     solver = new CFLSolver(graph, grammar);
+    solver->setNumOfThreads(Options::CFLSolverThreads());
 }
 
 void CFLAlias::finalize()
 {
-    numOfChecks = solver->numOfChecks;
+    collectSolverStat();
 
     if(Options::PrintCFL() == true)
     {
@@ -253,4 +254,5 @@ void POCRAlias::initialize()
 
     // Initialize POCRSolver
     solver = new POCRSolver(graph, grammar);
+    solver->setNumOfThreads(Options::CFLSolverThreads());
 }
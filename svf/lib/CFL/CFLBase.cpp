@@ -38,6 +38,8 @@ class CFLStat;
 double CFLBase::timeOfBuildCFLGrammar = 0;
 double CFLBase::timeOfNormalizeGrammar = 0;
 double CFLBase::timeOfBuildCFLGraph = 0;
+double CFLBase::numOfLoadedEdges = 0;
+double CFLBase::timeOfLoadingCFLGraph = 0;
 double CFLBase::timeOfSolving = 0;
 double CFLBase::numOfTerminalEdges = 0;
 double CFLBase::numOfTemporaryNonterminalEdges = 0;
@@ -45,6 +47,11 @@ double CFLBase::numOfNonterminalEdges = 0;
 double CFLBase::numOfStartEdges = 0;
 double CFLBase::numOfIteration = 1;
 double CFLBase::numOfChecks = 1;
+double CFLBase::numOfThreads = 1;
+double CFLBase::numOfRounds = 0;
+double CFLBase::timeOfWallSolving = 0;
+double CFLBase::timeOfWorkerBusy = 0;
+double CFLBase::timeOfDeriving = 0;
 
 void CFLBase::buildCFLGrammar()
 {
@@ -76,17 +83,33 @@ void CFLBase::buildCFLGraph()
         delete consCG;
     }
     else
-        graph = cflGraphBuilder.buildFromDot(Options::CFLGraph(), grammarBase);
+        graph = loadCFLGraph(cflGraphBuilder);
 
     // Check CFL Graph and Grammar are accordance with grammar
     CFLGramGraphChecker cflChecker = CFLGramGraphChecker();
     cflChecker.check(grammarBase, &cflGraphBuilder, graph);
 
+    writeCFLGraph(cflGraphBuilder);
+
     // Get time of build graph
     double end = stat->getClk(true);
     timeOfBuildCFLGraph += (end - start) / TIMEINTERVAL;
 }
 
+CFLGraph* CFLBase::loadCFLGraph(CFLGraphBuilder& cflGraphBuilder)
+{
+    CFLGraph* cflGraph = cflGraphBuilder.buildFromDot(Options::CFLGraph(), grammarBase);
+    numOfLoadedEdges = cflGraphBuilder.getNumOfLoadedEdges();
+    timeOfLoadingCFLGraph = cflGraphBuilder.getTimeOfLoading();
+    return cflGraph;
+}
+
+void CFLBase::writeCFLGraph(CFLGraphBuilder& cflGraphBuilder)
+{
+    if (!Options::WriteCFLGraph().empty())
+        cflGraphBuilder.writeBinary(graph, Options::WriteCFLGraph());
+}
+
 void CFLBase::normalizeCFLGrammar()
 {
     // Start normalize grammar
@@ -111,9 +134,19 @@ void CFLBase::solve()
     timeOfSolving += (end - start) / TIMEINTERVAL;
 }
 
-void CFLBase::finalize()
+void CFLBase::collectSolverStat()
 {
     numOfChecks = solver->numOfChecks;
+    numOfThreads = solver->getNumOfThreads();
+    numOfRounds = solver->numOfRounds;
+    timeOfWallSolving = solver->timeOfWallSolving;
+    timeOfWorkerBusy = solver->timeOfWorkerBusy;
+    timeOfDeriving = solver->timeOfDeriving;
+}
+
+void CFLBase::finalize()
+{
+    collectSolverStat();
 
     BVDataPTAImpl::finalize();
 }
@@ -30,6 +30,9 @@
 #include "CFL/CFLGraphBuilder.h"
 #include "Util/Options.h"
 #include "SVFIR/SVFValue.h"
+#include <chrono>
+#include <cstring>
+#include <thread>
 
 namespace SVF
 {
@@ -56,10 +59,8 @@ void CFLGraphBuilder::build(std::string filename, CFLGraph* cflGraph)
 {
 }
 
-CFLGraph * CFLGraphBuilder::buildFromDot(std::string fileName, GrammarBase *grammar)
+void CFLGraphBuilder::loadGrammarLabels(GrammarBase *grammar)
 {
-    CFLGraph *cflGraph = new CFLGraph(grammar->getStartKind());
-    externMap = true;
     for(auto pairV : grammar->getTerminals())
     {
         if(label2KindMap.find(pairV.first) == label2KindMap.end())
@@ -83,82 +84,354 @@ CFLGraph * CFLGraphBuilder::buildFromDot(std::string fileName, GrammarBase *gram
             kind2LabelMap.insert(make_pair(pairV.second, pairV.first));
         }
     }
+}
 
-    std::cout << "Building CFL Graph from dot file: " << fileName << "..\n";
-    std::string lineString;
-    std::ifstream inputFile(fileName);
+CFLGraphBuilder::Kind CFLGraphBuilder::resolveLabel(const std::string& label, u64_t lineNum)
+{
+    auto it = label2KindMap.find(label);
+    if (it != label2KindMap.end())
+        return it->second;
+
+    if (externMap == true && Options::FlexSymMap() == false)
+    {
+        std::string msg = "In line " + std::to_string(lineNum) + " sym can not find in grammar, please correct the input dot or set --flexsymmap.";
+        SVFUtil::errMsg(msg);
+        std::cout << msg;
+        abort();
+    }
+    label2KindMap.insert({label, current++});
+    return label2KindMap[label];
+}
+
+void CFLGraphBuilder::bulkBuild(CFLGraph* cflGraph, const std::vector<std::vector<LoadedEdge>>& edgeChunks,
+                                const std::vector<std::vector<Kind>>& labelKinds)
+{
+    /// Create all nodes first, in ascending order of their ids
+    std::vector<NodeID> nodeIds;
+    for (const std::vector<LoadedEdge>& edges : edgeChunks)
+    {
+        for (const LoadedEdge& edge : edges)
+        {
+            nodeIds.push_back(edge.src);
+            nodeIds.push_back(edge.dst);
+        }
+    }
+    std::sort(nodeIds.begin(), nodeIds.end());
+    nodeIds.erase(std::unique(nodeIds.begin(), nodeIds.end()), nodeIds.end());
+    for (NodeID id : nodeIds)
+    {
+        if (cflGraph->hasGNode(id) == false)
+            cflGraph->addCFLNode(id, new CFLNode(id));
+    }
+    std::vector<NodeID>().swap(nodeIds);
+
+    /// Then all edges
+    for (u32_t chunk = 0; chunk < edgeChunks.size(); ++chunk)
+    {
+        for (const LoadedEdge& edge : edgeChunks[chunk])
+        {
+            Kind kind = labelKinds[chunk][edge.label];
+            if (edge.attribute != 0)
+                kind = CFLGrammar::getAttributedKind(edge.attribute, kind);
+            cflGraph->addCFLEdge(cflGraph->getGNode(edge.src), cflGraph->getGNode(edge.dst), kind);
+        }
+    }
+}
+
+namespace
+{
+
+typedef std::chrono::steady_clock LoadClock;
+
+/// Parse a (hex) node id of a dot file starting at pos, return false if there is none
+inline bool parseDotNodeId(const char* line, size_t len, size_t& pos, NodeID& id)
+{
+    if (pos + 4 > len || strncmp(line + pos, "Node", 4) != 0)
+        return false;
+    pos += 4;
+    if (pos + 2 <= len && line[pos] == '0' && (line[pos + 1] == 'x' || line[pos + 1] == 'X'))
+        pos += 2;
+    u64_t value = 0;
+    size_t start = pos;
+    for (; pos < len && (isalnum(line[pos]) || line[pos] == '_'); ++pos)
+    {
+        char c = line[pos];
+        if (!isxdigit(c))
+            return false;
+        value = value * 16 + (isdigit(c) ? c - '0' : (tolower(c) - 'a' + 10));
+    }
+    id = value;
+    return pos != start;
+}
+
+inline void skipSpace(const char* line, size_t len, size_t& pos)
+{
+    while (pos < len && isspace(line[pos]))
+        pos++;
+}
 
-    std::regex reg("Node(\\w+)\\s*->\\s*Node(\\w+)\\s*\\[.*label=(.*)\\]");
+}
 
-    std::cout << std::boolalpha;
-    u32_t lineNum = 0 ;
+CFLGraph * CFLGraphBuilder::buildFromDot(std::string fileName, GrammarBase *grammar)
+{
+    LoadClock::time_point start = LoadClock::now();
+
+    CFLGraph *cflGraph = new CFLGraph(grammar->getStartKind());
+    externMap = true;
+    loadGrammarLabels(grammar);
     current = label2KindMap.size();
 
-    while (getline(inputFile, lineString))
+    MappedFile file;
+    if (!file.open(fileName))
+    {
+        SVFUtil::errMsg("Can't open CFL graph file `" + fileName + "`");
+        abort();
+    }
+
+    if (file.size() >= sizeof(binaryMagic) && memcmp(file.data(), binaryMagic, sizeof(binaryMagic)) == 0)
+    {
+        std::cout << "Building CFL Graph from binary edge list: " << fileName << "..\n";
+        delete cflGraph;
+        return buildFromBinary(file, grammar);
+    }
+
+    std::cout << "Building CFL Graph from dot file: " << fileName << "..\n";
+
+    /// Each thread parses whole lines of its own chunk into edges labelled by a chunk-local label table
+    std::vector<std::pair<size_t, size_t>> chunks = file.splitLines(Options::CFLSolverThreads());
+    std::vector<std::vector<LoadedEdge>> edgeChunks(chunks.size());
+    std::vector<std::vector<std::string>> chunkLabels(chunks.size());
+    std::vector<std::vector<u64_t>> chunkLabelLines(chunks.size());
+    std::vector<u64_t> chunkLineNums(chunks.size(), 0);
+
+    auto parseWorker = [&file, &chunks, &edgeChunks, &chunkLabels, &chunkLabelLines, &chunkLineNums](const u32_t chunk)
     {
-        lineNum += 1;
-        std::smatch matches;
-        if (std::regex_search(lineString, matches, reg))
+        Map<std::string, u32_t> localLabels;
+        std::vector<LoadedEdge>& edges = edgeChunks[chunk];
+        u64_t lineNum = 0;
+        const char* cur = file.data() + chunks[chunk].first;
+        const char* end = file.data() + chunks[chunk].second;
+        while (cur < end)
         {
-            CFLNode *src, *dst;
-            if (cflGraph->hasGNode(std::stoul(matches.str(1), nullptr, 16))==false)
-            {
-                src = new CFLNode(std::stoul(matches.str(1), nullptr, 16));
-                cflGraph->addCFLNode(src->getId(), src);
-            }
-            else
-            {
-                src = cflGraph->getGNode(std::stoul(matches.str(1), nullptr, 16));
-            }
-            if (cflGraph->hasGNode(std::stoul(matches.str(2), nullptr, 16))==false)
-            {
-                dst = new CFLNode(std::stoul(matches.str(2), nullptr, 16));
-                cflGraph->addCFLNode(dst->getId(), dst);
-            }
-            else
-            {
-                dst = cflGraph->getGNode(std::stoul(matches.str(2), nullptr, 16));
-            }
-            if (externMap == false)
+            const char* nl = static_cast<const char*>(memchr(cur, '\n', end - cur));
+            size_t len = (nl == nullptr ? end : nl) - cur;
+            lineNum++;
+
+            /// Node<src> -> Node<dst> [... label=<label>]
+            const char* nodeStart = static_cast<const char*>(memmem(cur, len, "Node", 4));
+            if (nodeStart != nullptr)
             {
-                if (label2KindMap.find(matches.str(3)) != label2KindMap.end())
+                size_t pos = nodeStart - cur;
+                LoadedEdge edge;
+                edge.attribute = 0;
+                bool matched = parseDotNodeId(cur, len, pos, edge.src);
+                if (matched)
                 {
-                    cflGraph->addCFLEdge(src, dst, label2KindMap[matches.str(3)]);
+                    skipSpace(cur, len, pos);
+                    matched = pos + 2 <= len && cur[pos] == '-' && cur[pos + 1] == '>';
+                    pos += 2;
                 }
-                else
+                if (matched)
                 {
-                    label2KindMap.insert({matches.str(3), current++});
-                    cflGraph->addCFLEdge(src, dst, label2KindMap[matches.str(3)]);
+                    skipSpace(cur, len, pos);
+                    matched = parseDotNodeId(cur, len, pos, edge.dst);
                 }
-            }
-            else
-            {
-                if (label2KindMap.find(matches.str(3)) != label2KindMap.end())
+                if (matched)
                 {
-                    cflGraph->addCFLEdge(src, dst, label2KindMap[matches.str(3)]);
+                    skipSpace(cur, len, pos);
+                    matched = pos < len && cur[pos] == '[';
                 }
-                else
+                if (matched)
                 {
-                    if(Options::FlexSymMap() == true)
-                    {
-                        label2KindMap.insert({matches.str(3), current++});
-                        cflGraph->addCFLEdge(src, dst, label2KindMap[matches.str(3)]);
-                    }
-                    else
+                    std::string line(cur + pos, len - pos);
+                    size_t labelPos = line.rfind("label=");
+                    size_t closePos = line.rfind(']');
+                    if (labelPos != std::string::npos && closePos != std::string::npos && closePos >= labelPos + 6)
                     {
-                        std::string msg = "In line " + std::to_string(lineNum) + " sym can not find in grammar, please correct the input dot or set --flexsymmap.";
-                        SVFUtil::errMsg(msg);
-                        std::cout << msg;
-                        abort();
+                        std::string label = line.substr(labelPos + 6, closePos - labelPos - 6);
+                        auto res = localLabels.insert(std::make_pair(label, chunkLabels[chunk].size()));
+                        if (res.second)
+                        {
+                            chunkLabels[chunk].push_back(label);
+                            chunkLabelLines[chunk].push_back(lineNum);
+                        }
+                        edge.label = res.first->second;
+                        edges.push_back(edge);
                     }
                 }
             }
+            cur += len + 1;
+        }
+        chunkLineNums[chunk] = lineNum;
+    };
+
+    std::vector<std::thread> workers;
+    for (u32_t chunk = 0; chunk < chunks.size(); ++chunk) workers.push_back(std::thread(parseWorker, chunk));
+    for (std::thread &worker : workers) worker.join();
+
+    /// Resolve chunk-local labels to kinds in file order, so that new labels get the same kinds as a serial read
+    std::vector<std::vector<Kind>> labelKinds(chunks.size());
+    u64_t linesBefore = 0;
+    for (u32_t chunk = 0; chunk < chunks.size(); ++chunk)
+    {
+        for (u32_t label = 0; label < chunkLabels[chunk].size(); ++label)
+            labelKinds[chunk].push_back(resolveLabel(chunkLabels[chunk][label], linesBefore + chunkLabelLines[chunk][label]));
+        linesBefore += chunkLineNums[chunk];
+    }
+
+    bulkBuild(cflGraph, edgeChunks, labelKinds);
+
+    numOfLoadedEdges = 0;
+    for (const std::vector<LoadedEdge>& edges : edgeChunks)
+        numOfLoadedEdges += edges.size();
+    timeOfLoading = std::chrono::duration<double>(LoadClock::now() - start).count();
+    return cflGraph;
+}
+
+const char CFLGraphBuilder::binaryMagic[8] = {'S', 'V', 'F', 'C', 'F', 'L', 'G', '1'};
+
+CFLGraph *CFLGraphBuilder::buildFromBinary(const MappedFile& file, GrammarBase *grammar)
+{
+    LoadClock::time_point start = LoadClock::now();
+
+    CFLGraph *cflGraph = new CFLGraph(grammar->getStartKind());
+    const char* cur = file.data() + sizeof(binaryMagic);
+    const char* end = file.data() + file.size();
+
+    auto read = [&cur, end](void* dst, size_t size)
+    {
+        if (cur + size > end)
+        {
+            SVFUtil::errMsg("truncated CFL binary edge list");
+            abort();
         }
+        memcpy(dst, cur, size);
+        cur += size;
+    };
+
+    /// Label table
+    u32_t numOfLabels = 0;
+    read(&numOfLabels, sizeof(u32_t));
+    std::vector<std::vector<Kind>> labelKinds(1);
+    for (u32_t i = 0; i < numOfLabels; ++i)
+    {
+        u32_t len = 0;
+        read(&len, sizeof(u32_t));
+        std::string label(len, '\0');
+        read(&label[0], len);
+        labelKinds[0].push_back(resolveLabel(label, 0));
+    }
+
+    /// Nodes, including those without edges
+    u64_t numOfNodes = 0;
+    read(&numOfNodes, sizeof(u64_t));
+    for (u64_t i = 0; i < numOfNodes; ++i)
+    {
+        NodeID id = 0;
+        read(&id, sizeof(NodeID));
+        if (cflGraph->hasGNode(id) == false)
+            cflGraph->addCFLNode(id, new CFLNode(id));
     }
-    inputFile.close();
+
+    /// Fixed-size edge records are copied out in parallel chunks
+    u64_t numOfEdges = 0;
+    read(&numOfEdges, sizeof(u64_t));
+    if (numOfEdges > (u64_t)(end - cur) / sizeof(LoadedEdge))
+    {
+        SVFUtil::errMsg("truncated CFL binary edge list");
+        abort();
+    }
+    const char* records = cur;
+    u32_t numOfChunks = std::max(1u, (u32_t)Options::CFLSolverThreads());
+    std::vector<std::vector<LoadedEdge>> edgeChunks(numOfChunks);
+    u64_t perChunk = numOfEdges / numOfChunks + 1;
+    auto copyWorker = [records, numOfEdges, perChunk, numOfLabels, &edgeChunks](const u32_t chunk)
+    {
+        u64_t begin = std::min(numOfEdges, chunk * perChunk);
+        u64_t end = std::min(numOfEdges, begin + perChunk);
+        std::vector<LoadedEdge>& edges = edgeChunks[chunk];
+        edges.resize(end - begin);
+        if (!edges.empty())
+            memcpy(edges.data(), records + begin * sizeof(LoadedEdge), edges.size() * sizeof(LoadedEdge));
+        for (const LoadedEdge& edge : edges)
+        {
+            if (edge.label >= numOfLabels)
+            {
+                SVFUtil::errMsg("invalid label index in CFL binary edge list");
+                abort();
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (u32_t chunk = 0; chunk < numOfChunks; ++chunk) workers.push_back(std::thread(copyWorker, chunk));
+    for (std::thread &worker : workers) worker.join();
+
+    /// All chunks share the one label table
+    labelKinds.resize(numOfChunks, labelKinds[0]);
+    bulkBuild(cflGraph, edgeChunks, labelKinds);
+
+    numOfLoadedEdges = numOfEdges;
+    timeOfLoading = std::chrono::duration<double>(LoadClock::now() - start).count();
     return cflGraph;
 }
 
+void CFLGraphBuilder::writeBinary(CFLGraph* cflGraph, std::string fileName)
+{
+    std::ofstream out(fileName, std::ios::binary);
+    if (!out.is_open())
+    {
+        SVFUtil::errMsg("Can't write CFL binary edge list `" + fileName + "`");
+        return;
+    }
+
+    /// Labels are written by name, so that kinds are resolved against the grammar when loading
+    Map<Kind, u32_t> kind2Label;
+    std::vector<std::string> labels;
+    for (const CFLEdge* edge : cflGraph->getCFLEdges())
+    {
+        Kind kind = edge->getEdgeKindWithMask();
+        if (kind2Label.find(kind) == kind2Label.end())
+        {
+            auto it = kind2LabelMap.find(kind);
+            assert(it != kind2LabelMap.end() && "edge kind without a label!");
+            kind2Label[kind] = labels.size();
+            labels.push_back(it->second);
+        }
+    }
+
+    out.write(binaryMagic, sizeof(binaryMagic));
+    u32_t numOfLabels = labels.size();
+    out.write(reinterpret_cast<const char*>(&numOfLabels), sizeof(u32_t));
+    for (const std::string& label : labels)
+    {
+        u32_t len = label.size();
+        out.write(reinterpret_cast<const char*>(&len), sizeof(u32_t));
+        out.write(label.data(), len);
+    }
+
+    u64_t numOfNodes = cflGraph->getTotalNodeNum();
+    out.write(reinterpret_cast<const char*>(&numOfNodes), sizeof(u64_t));
+    for (auto it = cflGraph->begin(); it != cflGraph->end(); ++it)
+    {
+        NodeID id = it->first;
+        out.write(reinterpret_cast<const char*>(&id), sizeof(NodeID));
+    }
+
+    u64_t numOfEdges = cflGraph->getCFLEdges().size();
+    out.write(reinterpret_cast<const char*>(&numOfEdges), sizeof(u64_t));
+    for (const CFLEdge* edge : cflGraph->getCFLEdges())
+    {
+        LoadedEdge record;
+        record.src = edge->getSrcID();
+        record.dst = edge->getDstID();
+        record.label = kind2Label[edge->getEdgeKindWithMask()];
+        record.attribute = edge->getEdgeAttri();
+        out.write(reinterpret_cast<const char*>(&record), sizeof(LoadedEdge));
+    }
+    out.close();
+}
+
 CFLGraph* AliasCFLGraphBuilder::buildBigraph(ConstraintGraph *graph, Kind startKind, GrammarBase *grammar)
 {
     CFLGraph *cflGraph = new CFLGraph(startKind);
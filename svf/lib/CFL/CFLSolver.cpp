@@ -28,10 +28,80 @@
  */
 
 #include "CFL/CFLSolver.h"
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
 
 using namespace SVF;
 
 double CFLSolver::numOfChecks = 0;
+double CFLSolver::numOfRounds = 0;
+double CFLSolver::timeOfWallSolving = 0;
+double CFLSolver::timeOfWorkerBusy = 0;
+double CFLSolver::timeOfDeriving = 0;
+
+namespace
+{
+
+typedef std::chrono::steady_clock SolverClock;
+
+inline double secondsSince(const SolverClock::time_point& start)
+{
+    return std::chrono::duration<double>(SolverClock::now() - start).count();
+}
+
+/*!
+ * Concurrent set of derived edges X(src,dst) used to deduplicate edges found
+ * by different workers within one round. The set is partitioned by the source
+ * node, each partition being owned by one lock, so that workers deriving edges
+ * for different nodes rarely contend. The partitions double as commit buffers.
+ */
+class ConcurrentCFLEdgeSet
+{
+public:
+    typedef std::pair<NodePair, u32_t> EdgeKey;
+
+    ConcurrentCFLEdgeSet(u32_t numOfParts) : parts(numOfParts), edges(numOfParts), locks(new std::mutex[numOfParts])
+    {
+    }
+
+    ~ConcurrentCFLEdgeSet()
+    {
+        delete[] locks;
+    }
+
+    /// Insert an edge, return true if no worker inserted it before
+    bool insert(const CFLSolver::DerivedEdge& edge)
+    {
+        u32_t part = edge.src % parts.size();
+        EdgeKey key = std::make_pair(std::make_pair(edge.src, edge.dst), u32_t(edge.label));
+        std::lock_guard<std::mutex> guard(locks[part]);
+        if (parts[part].insert(key).second)
+        {
+            edges[part].push_back(edge);
+            return true;
+        }
+        return false;
+    }
+
+    inline u32_t getNumOfParts() const
+    {
+        return parts.size();
+    }
+
+    inline const CFLSolver::DerivedEdges& getEdges(u32_t part) const
+    {
+        return edges[part];
+    }
+
+private:
+    std::vector<Set<EdgeKey>> parts;
+    std::vector<CFLSolver::DerivedEdges> edges;
+    std::mutex* locks;
+};
+
+}
 
 void CFLSolver::initialize()
 {
@@ -118,14 +188,142 @@ void CFLSolver::processCFLEdge(const CFLEdge* Y_edge)
 
 void CFLSolver::solve()
 {
+    SolverClock::time_point start = SolverClock::now();
+
     /// initial worklist
     initialize();
 
-    while(!isWorklistEmpty())
+    if (numOfThreads > 1)
+    {
+        solveInParallel();
+    }
+    else
+    {
+        while(!isWorklistEmpty())
+        {
+            /// Select and remove an edge Y(i,j) from worklist
+            const CFLEdge* Y_edge = popFromWorklist();
+            processCFLEdge(Y_edge);
+        }
+    }
+
+    timeOfWallSolving += secondsSince(start);
+}
+
+void CFLSolver::deriveCFLEdges(const CFLEdge* Y_edge, DerivedEdges& derived, double& checks)
+{
+    const CFLNode* i = Y_edge->getSrcNode();
+    const CFLNode* j = Y_edge->getDstNode();
+
+    /// For each production X -> Y
+    ///     derive X(i,j) if not exist in E
+    Symbol Y = Y_edge->getEdgeKind();
+    if (grammar->hasProdsFromSingleRHS(Y))
+        for(const Production& prod : grammar->getProdsFromSingleRHS(Y))
+        {
+            Symbol X = grammar->getLHSSymbol(prod);
+            checks++;
+            if (!graph->hasEdge(Y_edge->getSrcNode(), Y_edge->getDstNode(), X))
+                derived.emplace_back(i->getId(), j->getId(), X);
+        }
+
+    /// For each production X -> Y Z
+    /// Foreach outgoing edge Z(j,k) from node j do
+    ///     derive X(i,k) if not exist in E
+    if (grammar->hasProdsFromFirstRHS(Y))
+        for(const Production& prod : grammar->getProdsFromFirstRHS(Y))
+        {
+            Symbol X = grammar->getLHSSymbol(prod);
+            for(const CFLEdge* Z_edge : j->getOutEdgeWithTy(grammar->getSecondRHSSymbol(prod)))
+            {
+                checks++;
+                if (!graph->hasEdge(Y_edge->getSrcNode(), Z_edge->getDstNode(), X))
+                    derived.emplace_back(i->getId(), Z_edge->getDstID(), X);
+            }
+        }
+
+    /// For each production X -> Z Y
+    /// Foreach incoming edge Z(k,i) to node i do
+    ///     derive X(k,j) if not exist in E
+    if(grammar->hasProdsFromSecondRHS(Y))
+        for(const Production& prod : grammar->getProdsFromSecondRHS(Y))
+        {
+            Symbol X = grammar->getLHSSymbol(prod);
+            for(const CFLEdge* Z_edge : i->getInEdgeWithTy(grammar->getFirstRHSSymbol(prod)))
+            {
+                checks++;
+                if (!graph->hasEdge(Z_edge->getSrcNode(), Y_edge->getDstNode(), X))
+                    derived.emplace_back(Z_edge->getSrcID(), j->getId(), X);
+            }
+        }
+}
+
+const CFLEdge* CFLSolver::commitCFLEdge(const DerivedEdge& edge)
+{
+    return graph->addCFLEdge(graph->getGNode(edge.src), graph->getGNode(edge.dst), edge.label);
+}
+
+void CFLSolver::solveInParallel()
+{
+    /// Edges handed to a worker at once
+    static const size_t chunkSize = 256;
+
+    std::vector<const CFLEdge*> frontier;
+    while (!isWorklistEmpty())
     {
-        /// Select and remove an edge Y(i,j) from worklist
-        const CFLEdge* Y_edge = popFromWorklist();
-        processCFLEdge(Y_edge);
+        numOfRounds++;
+        frontier.clear();
+        while (!isWorklistEmpty())
+            frontier.push_back(popFromWorklist());
+
+        /// Derive phase: the graph is only read
+        ConcurrentCFLEdgeSet derivedSet(numOfThreads * 4);
+        std::atomic<size_t> nextChunk(0);
+        std::vector<double> checksOfWorker(numOfThreads, 0);
+        std::vector<double> busyOfWorker(numOfThreads, 0);
+
+        auto deriveWorker = [this, &frontier, &derivedSet, &nextChunk, &checksOfWorker, &busyOfWorker]
+                            (const u32_t thread)
+        {
+            SolverClock::time_point start = SolverClock::now();
+            DerivedEdges derived;
+            while (true)
+            {
+                size_t begin = nextChunk.fetch_add(chunkSize);
+                if (begin >= frontier.size()) break;
+                size_t end = std::min(begin + chunkSize, frontier.size());
+                for (size_t e = begin; e < end; ++e)
+                {
+                    derived.clear();
+                    this->deriveCFLEdges(frontier[e], derived, checksOfWorker[thread]);
+                    for (const DerivedEdge& edge : derived)
+                        derivedSet.insert(edge);
+                }
+            }
+            busyOfWorker[thread] = secondsSince(start);
+        };
+
+        SolverClock::time_point deriveStart = SolverClock::now();
+        std::vector<std::thread> workers;
+        for (u32_t t = 0; t < numOfThreads; ++t) workers.push_back(std::thread(deriveWorker, t));
+        for (std::thread &worker : workers) worker.join();
+        timeOfDeriving += secondsSince(deriveStart);
+
+        for (u32_t t = 0; t < numOfThreads; ++t)
+        {
+            numOfChecks += checksOfWorker[t];
+            timeOfWorkerBusy += busyOfWorker[t];
+        }
+
+        /// Commit phase: derived edges become the next frontier
+        for (u32_t part = 0; part < derivedSet.getNumOfParts(); ++part)
+        {
+            for (const DerivedEdge& edge : derivedSet.getEdges(part))
+            {
+                if (const CFLEdge* newEdge = commitCFLEdge(edge))
+                    pushIntoWorklist(newEdge);
+            }
+        }
     }
 }
 
@@ -189,6 +387,59 @@ void POCRSolver::processCFLEdge(const CFLEdge* Y_edge)
         }
 }
 
+void POCRSolver::deriveCFLEdges(const CFLEdge* Y_edge, DerivedEdges& derived, double& checks)
+{
+    NodeID i = Y_edge->getSrcID();
+    NodeID j = Y_edge->getDstID();
+
+    /// For each production X -> Y
+    ///     derive X(i,j) if not exist in CFLData
+    Symbol Y = Y_edge->getEdgeKind();
+    if (grammar->hasProdsFromSingleRHS(Y))
+        for(const Production& prod : grammar->getProdsFromSingleRHS(Y))
+        {
+            Symbol X = grammar->getLHSSymbol(prod);
+            checks++;
+            if (!hasEdge(i, j, X))
+                derived.emplace_back(i, j, X);
+        }
+
+    /// For each production X -> Y Z
+    /// Foreach Z successor k of node j do
+    ///     derive X(i,k) if not exist in CFLData
+    if (grammar->hasProdsFromFirstRHS(Y))
+        for(const Production& prod : grammar->getProdsFromFirstRHS(Y))
+        {
+            Symbol X = grammar->getLHSSymbol(prod);
+            const NodeBS& dsts = findSuccs(j, grammar->getSecondRHSSymbol(prod));
+            checks += dsts.count();
+            for (NodeID k : dsts)
+                if (!hasEdge(i, k, X))
+                    derived.emplace_back(i, k, X);
+        }
+
+    /// For each production X -> Z Y
+    /// Foreach Z predecessor k of node i do
+    ///     derive X(k,j) if not exist in CFLData
+    if(grammar->hasProdsFromSecondRHS(Y))
+        for(const Production& prod : grammar->getProdsFromSecondRHS(Y))
+        {
+            Symbol X = grammar->getLHSSymbol(prod);
+            const NodeBS& srcs = findPreds(i, grammar->getFirstRHSSymbol(prod));
+            checks += srcs.count();
+            for (NodeID k : srcs)
+                if (!hasEdge(k, j, X))
+                    derived.emplace_back(k, j, X);
+        }
+}
+
+const CFLEdge* POCRSolver::commitCFLEdge(const DerivedEdge& edge)
+{
+    if (addEdge(edge.src, edge.dst, edge.label))
+        return graph->addCFLEdge(graph->getGNode(edge.src), graph->getGNode(edge.dst), edge.label);
+    return nullptr;
+}
+
 void POCRSolver::initialize()
 {
     for(auto it = graph->begin(); it!= graph->end(); it++)
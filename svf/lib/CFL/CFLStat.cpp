@@ -50,6 +50,14 @@ void  CFLStat::CFLGraphStat()
     CFLGraph* CFLGraph = pta->getCFLGraph();
 
     timeStatMap["BuildingTime"] = pta->timeOfBuildCFLGraph;
+    if (pta->numOfLoadedEdges > 0)
+    {
+        // Loading from -cflgraph, measured in wall-clock time apart from the solving time
+        timeStatMap["LoadingTime"] = pta->timeOfLoadingCFLGraph;
+        if (pta->timeOfLoadingCFLGraph > 0)
+            timeStatMap["LoadEdgesPerSec"] = pta->numOfLoadedEdges / pta->timeOfLoadingCFLGraph;
+        PTNumStatMap["NumOfLoadedEdges"] = pta->numOfLoadedEdges;
+    }
     PTNumStatMap["NumOfNodes"] = CFLGraph->getTotalNodeNum();
     PTNumStatMap["NumOfEdges"] = CFLGraph->getCFLEdges().size();
 
@@ -71,6 +79,19 @@ void CFLStat::CFLSolverStat()
     PTNumStatMap["numOfIteration"] = pta->numOfIteration;
     PTNumStatMap["SumEdges"] = pta->numOfStartEdges;
 
+    // Throughput and scaling of the (parallel) solver, measured in wall-clock time
+    PTNumStatMap["NumOfThreads"] = pta->numOfThreads;
+    PTNumStatMap["NumOfRounds"] = pta->numOfRounds;
+    timeStatMap["WallSolvingTime"] = pta->timeOfWallSolving;
+    if (pta->timeOfWallSolving > 0)
+        timeStatMap["ChecksPerSec"] = pta->numOfChecks / pta->timeOfWallSolving;
+    if (pta->timeOfDeriving > 0)
+    {
+        // Effective parallelism of the derivation phases and its efficiency w.r.t. the thread count
+        timeStatMap["DeriveSpeedup"] = pta->timeOfWorkerBusy / pta->timeOfDeriving;
+        timeStatMap["DeriveEfficiency"] = pta->timeOfWorkerBusy / (pta->timeOfDeriving * pta->numOfThreads);
+    }
+
     PTAStat::printStat("CFL-reachability Solver Stats");
 }
 
@@ -46,11 +46,13 @@ void CFLVF::buildCFLGraph()
         graph = cflGraphBuilder.buildBigraph(svfg, grammarBase->getStartKind(), grammarBase);
     }
     else
-        graph = cflGraphBuilder.buildFromDot(Options::CFLGraph(), grammarBase);
+        graph = loadCFLGraph(cflGraphBuilder);
 
     // Check CFL Graph and Grammar are accordance with grammar
     CFLGramGraphChecker cflChecker = CFLGramGraphChecker();
     cflChecker.check(grammarBase, &cflGraphBuilder, graph);
+
+    writeCFLGraph(cflGraphBuilder);
 }
 
 void CFLVF::initialize()
@@ -66,10 +68,13 @@ void CFLVF::initialize()
 
     // Initialize sovler
     solver = new CFLSolver(graph, grammar);
+    solver->setNumOfThreads(Options::CFLSolverThreads());
 }
 
 void CFLVF::finalize()
 {
+    collectSolverStat();
+
     if(Options::PrintCFL())
     {
         if (Options::CFLGraph().empty())
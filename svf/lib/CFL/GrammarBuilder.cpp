@@ -33,13 +33,15 @@
 #include <sstream>
 #include <iostream>
 #include "CFL/GrammarBuilder.h"
+#include "Util/MappedFile.h"
+#include <cstring>
 
 namespace SVF
 {
 const inline std::string GrammarBuilder::parseProductionsString() const
 {
-    std::ifstream textFile(fileName);
-    if (!textFile.is_open())
+    MappedFile textFile;
+    if (!textFile.open(fileName))
     {
         std::cerr << "Can't open CFL grammar file `" << fileName << "`" << std::endl;
         abort();
@@ -50,8 +52,14 @@ const inline std::string GrammarBuilder::parseProductionsString() const
     std::string symbolString;
     const std::string WHITESPACE = " \n\r\t\f\v";
     int lineNum = 0;
-    while (getline(textFile, lineString))
+    const char* cur = textFile.data();
+    const char* end = textFile.data() + textFile.size();
+    while (cur < end)
     {
+        const char* nl = static_cast<const char*>(memchr(cur, '\n', end - cur));
+        lineString.assign(cur, nl == nullptr ? end : nl);
+        cur = nl == nullptr ? end : nl + 1;
+
         if(lineNum == 1)
         {
             startString = stripSpace(lineString);
@@ -57,6 +57,9 @@ void DDAPass::runOnModule(SVFIR* pag)
     /// initialization for llvm alias analyzer
     //InitializeAliasAnalysis(this, getDataLayout(&module));
 
+    /// queries are collected from the SVFIR, so materialize it first under -lazy-svfir
+    pag->materializeReachableFunctions();
+
     selectClient(pag->getModule());
 
     for (u32_t i = PointerAnalysis::FlowS_DDA;
@@ -34,6 +34,8 @@
 
 using namespace SVF;
 
+const CFLEdge::CFLEdgeSetTy CFLNode::emptyCFLEdgeSet;
+
 CFLGraph::Kind CFLGraph::getStartKind() const
 {
     return this->startKind;
@@ -99,89 +99,150 @@ CHNode *CHGraph::getNode(const string name) const
  */
 void CHGraph::getVFnsFromVtbls(CallSite cs, const VTableSet &vtbls, VFunSet &virtualFunctions)
 {
+    resolveVFns(cs, vtbls, virtualFunctions);
+}
 
-    /// get target virtual functions
-    size_t idx = cs.getFunIdxInVtable();
-    /// get the function name of the virtual callsite
-    string funName = cs.getFunNameOfVirtualCall();
-    for (const SVFGlobalValue *vt : vtbls)
-    {
-        const CHNode *child = getNode(cppUtil::getClassNameFromVtblObj(vt->getName()));
-        if (child == nullptr)
-            continue;
-        CHNode::FuncVector vfns;
+void CHGraph::getVFnsOfVtbl(const SVFGlobalValue *vtbl, u32_t idx, VFunVector &vfns)
+{
+    const CHNode *child = getNode(cppUtil::getClassNameFromVtblObj(vtbl->getName()));
+    if (child != nullptr)
         child->getVirtualFunctions(idx, vfns);
-        for (CHNode::FuncVector::const_iterator fit = vfns.begin(),
-                feit = vfns.end(); fit != feit; ++fit)
+}
+
+bool CHGraph::matchesVCallSignature(CallSite cs, const SVFFunction* callee)
+{
+    // if argument types do not match
+    // skip this one
+    return checkArgTypes(cs, callee);
+}
+
+/*
+ * Get the ID of a vtable set. Vtables are numbered densely on first sight
+ * so that a set can be keyed by the bitset of its vtables' IDs.
+ */
+CommonCHGraph::VTableSetID CommonCHGraph::getVTableSetID(const VTableSet &vtbls)
+{
+    NodeBS vtblIDs;
+    for (const SVFGlobalValue *vtbl : vtbls)
+    {
+        std::pair<Map<const SVFGlobalValue*, NodeID>::iterator, bool> idIt = vtblToID.emplace(vtbl, vtblToID.size());
+        vtblIDs.set(idIt.first->second);
+    }
+
+    std::pair<Map<NodeBS, VTableSetID>::iterator, bool> setIt = vtblSetToID.emplace(vtblIDs, vtblSets.size());
+    if (setIt.second)
+        vtblSets.push_back(vtbls);
+    return setIt.first->second;
+}
+
+/*
+ * Get the (distinct) functions in slot "idx" of the vtables of set "id".
+ * This only depends on the vtables, so it is shared by all callsites.
+ */
+const CommonCHGraph::VFunVector &CommonCHGraph::getVFnsAtIdx(VTableSetID id, u32_t idx)
+{
+    std::pair<Map<std::pair<VTableSetID, u32_t>, VFunVector>::iterator, bool> it =
+        vfnsAtIdx.emplace(std::make_pair(id, idx), VFunVector());
+    if (it.second)
+    {
+        VFunVector vfns;
+        for (const SVFGlobalValue *vtbl : getVTableSet(id))
+            getVFnsOfVtbl(vtbl, idx, vfns);
+
+        VFunSet seen;
+        for (const SVFFunction *vfn : vfns)
         {
-            const SVFFunction* callee = *fit;
-            if (cs.arg_size() == callee->arg_size() ||
-                    (cs.isVarArg() && callee->isVarArg()))
-            {
+            if (seen.insert(vfn).second)
+                it.first->second.push_back(vfn);
+        }
+    }
+    return it.first->second;
+}
 
-                // if argument types do not match
-                // skip this one
-                if (!checkArgTypes(cs, callee))
-                    continue;
-
-                cppUtil::DemangledName dname = cppUtil::demangle(callee->getName());
-                string calleeName = dname.funcName;
-
-                /*
-                 * The compiler will add some special suffix (e.g.,
-                 * "[abi:cxx11]") to the end of some virtual function:
-                 * In dealII
-                 * function: FE_Q<3>::get_name
-                 * will be mangled as: _ZNK4FE_QILi3EE8get_nameB5cxx11Ev
-                 * after demangling: FE_Q<3>::get_name[abi:cxx11]
-                 * The special suffix ("[abi:cxx11]") needs to be removed
-                 */
-                const std::string suffix("[abi:cxx11]");
-                size_t suffix_pos = calleeName.rfind(suffix);
-                if (suffix_pos != string::npos)
-                    calleeName.erase(suffix_pos, suffix.size());
-
-                /*
-                 * if we can't get the function name of a virtual callsite, all virtual
-                 * functions calculated by idx will be valid
-                 */
-                if (funName.size() == 0)
-                {
-                    virtualFunctions.insert(callee);
-                }
-                else if (funName[0] == '~')
-                {
-                    /*
-                     * if the virtual callsite is calling a destructor, then all
-                     * destructors in the ch will be valid
-                     * class A { virtual ~A(){} };
-                     * class B: public A { virtual ~B(){} };
-                     * int main() {
-                     *   A *a = new B;
-                     *   delete a;  /// the function name of this virtual callsite is ~A()
-                     * }
-                     */
-                    if (calleeName[0] == '~')
-                    {
-                        virtualFunctions.insert(callee);
-                    }
-                }
-                else
-                {
-                    /*
-                     * for other virtual function calls, the function name of the callsite
-                     * and the function name of the target callee should match exactly
-                     */
-                    if (funName.compare(calleeName) == 0)
-                    {
-                        virtualFunctions.insert(callee);
-                    }
-                }
-            }
+void CommonCHGraph::resolveVFns(CallSite cs, const VTableSet &vtbls, VFunSet &virtualFunctions)
+{
+    if (vtbls.empty())
+        return;
+
+    VTableSetID id = getVTableSetID(vtbls);
+    std::pair<Map<std::pair<const SVFInstruction*, VTableSetID>, VFunSet>::iterator, bool> it =
+        resolvedVFns.emplace(std::make_pair(cs.getInstruction(), id), VFunSet());
+    if (it.second)
+    {
+        /// get the function name of the virtual callsite
+        const string funName = cs.getFunNameOfVirtualCall();
+        for (const SVFFunction *callee : getVFnsAtIdx(id, cs.getFunIdxInVtable()))
+        {
+            if (isVCallTarget(cs, funName, callee))
+                it.first->second.insert(callee);
         }
     }
+    virtualFunctions.insert(it.first->second.begin(), it.first->second.end());
 }
 
+const std::string &CommonCHGraph::getVFnMatchName(const SVFFunction *fn)
+{
+    Map<const SVFFunction*, std::string>::const_iterator it = vfnMatchNames.find(fn);
+    if (it != vfnMatchNames.end())
+        return it->second;
+
+    string calleeName = cppUtil::demangle(fn->getName()).funcName;
+
+    /*
+     * The compiler will add some special suffix (e.g.,
+     * "[abi:cxx11]") to the end of some virtual function:
+     * In dealII
+     * function: FE_Q<3>::get_name
+     * will be mangled as: _ZNK4FE_QILi3EE8get_nameB5cxx11Ev
+     * after demangling: FE_Q<3>::get_name[abi:cxx11]
+     * The special suffix ("[abi:cxx11]") needs to be removed
+     */
+    const std::string suffix("[abi:cxx11]");
+    size_t suffix_pos = calleeName.rfind(suffix);
+    if (suffix_pos != string::npos)
+        calleeName.erase(suffix_pos, suffix.size());
+
+    return vfnMatchNames[fn] = calleeName;
+}
+
+bool CommonCHGraph::isVCallTarget(CallSite cs, const std::string &funName, const SVFFunction *callee)
+{
+    if (cs.arg_size() != callee->arg_size() &&
+            !(cs.isVarArg() && callee->isVarArg()))
+        return false;
+
+    if (!matchesVCallSignature(cs, callee))
+        return false;
+
+    /*
+     * if we can't get the function name of a virtual callsite, all virtual
+     * functions calculated by idx will be valid
+     */
+    if (funName.size() == 0)
+        return true;
+
+    const std::string &calleeName = getVFnMatchName(callee);
+    if (funName[0] == '~')
+    {
+        /*
+         * if the virtual callsite is calling a destructor, then all
+         * destructors in the ch will be valid
+         * class A { virtual ~A(){} };
+         * class B: public A { virtual ~B(){} };
+         * int main() {
+         *   A *a = new B;
+         *   delete a;  /// the function name of this virtual callsite is ~A()
+         * }
+         */
+        return calleeName[0] == '~';
+    }
+
+    /*
+     * for other virtual function calls, the function name of the callsite
+     * and the function name of the target callee should match exactly
+     */
+    return funName.compare(calleeName) == 0;
+}
 
 void CHNode::getVirtualFunctions(u32_t idx, FuncVector &virtualFunctions) const
 {
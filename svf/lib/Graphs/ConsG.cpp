@@ -557,7 +557,8 @@ bool ConstraintGraph::moveOutEdgesToRepNode(ConstraintNode*node, ConstraintNode*
  */
 void ConstraintGraph::dump(std::string name)
 {
-    GraphPrinter::WriteGraphToFile(outs(), name, this);
+    ExportGraphToFile(outs(), name, this, false, Options::DumpGraphFormat(),
+                      Options::DumpGraphColumns(), Options::DumpGraphThreads());
 }
 
 /*!
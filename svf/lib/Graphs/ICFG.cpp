@@ -441,7 +441,8 @@ ICFGEdge* ICFG::addRetEdge(ICFGNode* srcNode, ICFGNode* dstNode, const SVFInstru
  */
 void ICFG::dump(const std::string& file, bool simple)
 {
-    GraphPrinter::WriteGraphToFile(outs(), file, this, simple);
+    ExportGraphToFile(outs(), file, this, simple, Options::DumpGraphFormat(),
+                      Options::DumpGraphColumns(), Options::DumpGraphThreads());
 }
 
 /*!
@@ -101,7 +101,8 @@ SVFStmt* IRGraph::hasLabeledEdge(SVFVar* src, SVFVar* dst, SVFStmt::PEDGEK kind,
  */
 void IRGraph::dump(std::string name)
 {
-    GraphPrinter::WriteGraphToFile(outs(), name, this);
+    ExportGraphToFile(outs(), name, this, false, Options::DumpGraphFormat(),
+                      Options::DumpGraphColumns(), Options::DumpGraphThreads());
 }
 
 /*!
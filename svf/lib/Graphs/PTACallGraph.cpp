@@ -32,6 +32,7 @@
 #include "SVFIR/SVFModule.h"
 #include "Util/SVFUtil.h"
 #include "Graphs/PTACallGraph.h"
+#include "Util/Options.h"
 
 using namespace SVF;
 using namespace SVFUtil;
@@ -316,7 +317,8 @@ bool PTACallGraph::isReachableBetweenFunctions(const SVFFunction* srcFn, const S
  */
 void PTACallGraph::dump(const std::string& filename)
 {
-    GraphPrinter::WriteGraphToFile(outs(), filename, this);
+    ExportGraphToFile(outs(), filename, this, false, Options::DumpGraphFormat(),
+                      Options::DumpGraphColumns(), Options::DumpGraphThreads());
 }
 
 void PTACallGraph::view()
@@ -36,6 +36,7 @@
 #include "Util/Options.h"
 #include "MemoryModel/PointerAnalysisImpl.h"
 #include <fstream>
+#include <thread>
 #include "Util/Options.h"
 
 using namespace SVF;
@@ -321,100 +322,143 @@ void SVFG::addSVFGNodesForAddrTakenVars()
 }
 
 /*
- * Connect def-use chains for indirect value-flow, (value-flow of address-taken variables)
+ * Connect def-use chains for indirect value-flow, (value-flow of address-taken variables).
+ * As for direct edges, -vfg-build-threads collects the edges within functions
+ * on worker threads before the edges across functions are added.
  */
 void SVFG::connectIndirectSVFGEdges()
 {
-
-    for(iterator it = begin(), eit = end(); it!=eit; ++it)
+    if (Options::VFGBuildThreads() > 1)
     {
-        NodeID nodeId = it->first;
-        const SVFGNode* node = it->second;
-        if(const LoadSVFGNode* loadNode = SVFUtil::dyn_cast<LoadSVFGNode>(node))
+        std::vector<std::vector<NodeID>> partitions;
+        partitionNodesByFunction(partitions);
+
+        std::vector<std::vector<IndirectVFEdgeInfo>> edgeBuffers(partitions.size());
+        auto worker = [this, &partitions, &edgeBuffers](const u32_t thread)
         {
-            MUSet& muSet = mssa->getMUSet(SVFUtil::cast<LoadStmt>(loadNode->getPAGEdge()));
-            for(MUSet::iterator it = muSet.begin(), eit = muSet.end(); it!=eit; ++it)
-            {
-                if(LOADMU* mu = SVFUtil::dyn_cast<LOADMU>(*it))
-                {
-                    NodeID def = getDef(mu->getMRVer());
-                    addIntraIndirectVFEdge(def,nodeId, mu->getMRVer()->getMR()->getPointsTo());
-                }
-            }
-        }
-        else if(const StoreSVFGNode* storeNode = SVFUtil::dyn_cast<StoreSVFGNode>(node))
+            for (NodeID nodeId : partitions[thread])
+                getIntraIndirectVFEdges(getSVFGNode(nodeId), edgeBuffers[thread]);
+        };
+        std::vector<std::thread> workers;
+        for (u32_t i = 0; i < partitions.size(); ++i)
+            workers.push_back(std::thread(worker, i));
+        for (std::thread& t : workers)
+            t.join();
+
+        for (const std::vector<IndirectVFEdgeInfo>& edges : edgeBuffers)
         {
-            CHISet& chiSet = mssa->getCHISet(SVFUtil::cast<StoreStmt>(storeNode->getPAGEdge()));
-            for(CHISet::iterator it = chiSet.begin(), eit = chiSet.end(); it!=eit; ++it)
-            {
-                if(STORECHI* chi = SVFUtil::dyn_cast<STORECHI>(*it))
-                {
-                    NodeID def = getDef(chi->getOpVer());
-                    addIntraIndirectVFEdge(def,nodeId, chi->getOpVer()->getMR()->getPointsTo());
-                }
-            }
+            for (const IndirectVFEdgeInfo& edge : edges)
+                addIntraIndirectVFEdge(edge.first.first, edge.first.second, *edge.second);
         }
-        else if(const FormalINSVFGNode* formalIn = SVFUtil::dyn_cast<FormalINSVFGNode>(node))
+        for (iterator it = begin(), eit = end(); it != eit; ++it)
+            connectInterIndirectVFEdges(it->second);
+    }
+    else
+    {
+        std::vector<IndirectVFEdgeInfo> edges;
+        for (iterator it = begin(), eit = end(); it != eit; ++it)
         {
-            PTACallGraphEdge::CallInstSet callInstSet;
-            mssa->getPTA()->getPTACallGraph()->getDirCallSitesInvokingCallee(formalIn->getFun(),callInstSet);
-            for(PTACallGraphEdge::CallInstSet::iterator it = callInstSet.begin(), eit = callInstSet.end(); it!=eit; ++it)
-            {
-                const CallICFGNode* cs = *it;
-                if(!mssa->hasMU(cs))
-                    continue;
-                ActualINSVFGNodeSet& actualIns = getActualINSVFGNodes(cs);
-                for(ActualINSVFGNodeSet::iterator ait = actualIns.begin(), aeit = actualIns.end(); ait!=aeit; ++ait)
-                {
-                    const ActualINSVFGNode* actualIn = SVFUtil::cast<ActualINSVFGNode>(getSVFGNode(*ait));
-                    addInterIndirectVFCallEdge(actualIn,formalIn,getCallSiteID(cs, formalIn->getFun()));
-                }
-            }
+            edges.clear();
+            getIntraIndirectVFEdges(it->second, edges);
+            for (const IndirectVFEdgeInfo& edge : edges)
+                addIntraIndirectVFEdge(edge.first.first, edge.first.second, *edge.second);
+            connectInterIndirectVFEdges(it->second);
         }
-        else if(const FormalOUTSVFGNode* formalOut = SVFUtil::dyn_cast<FormalOUTSVFGNode>(node))
+    }
+
+    connectFromGlobalToProgEntry();
+}
+
+/*!
+ * Indirect def-use edges within a function. Every load and store already has
+ * its mu/chi set, so the graph and memory SSA are only read here and this may
+ * run on worker threads.
+ */
+void SVFG::getIntraIndirectVFEdges(const SVFGNode* node, std::vector<IndirectVFEdgeInfo>& edges) const
+{
+    NodeID nodeId = node->getId();
+    auto addEdgeFromDef = [&](const MRVer* ver)
+    {
+        edges.push_back(std::make_pair(std::make_pair(getDef(ver), nodeId), &ver->getMR()->getPointsTo()));
+    };
+
+    if(const LoadSVFGNode* loadNode = SVFUtil::dyn_cast<LoadSVFGNode>(node))
+    {
+        MUSet& muSet = mssa->getMUSet(SVFUtil::cast<LoadStmt>(loadNode->getPAGEdge()));
+        for(MUSet::iterator it = muSet.begin(), eit = muSet.end(); it!=eit; ++it)
         {
-            PTACallGraphEdge::CallInstSet callInstSet;
-            // const MemSSA::RETMU* retMu = formalOut->getRetMU();
-            mssa->getPTA()->getPTACallGraph()->getDirCallSitesInvokingCallee(formalOut->getFun(),callInstSet);
-            for(PTACallGraphEdge::CallInstSet::iterator it = callInstSet.begin(), eit = callInstSet.end(); it!=eit; ++it)
-            {
-                const CallICFGNode* cs = *it;
-                if(!mssa->hasCHI(cs))
-                    continue;
-                ActualOUTSVFGNodeSet& actualOuts = getActualOUTSVFGNodes(cs);
-                for(ActualOUTSVFGNodeSet::iterator ait = actualOuts.begin(), aeit = actualOuts.end(); ait!=aeit; ++ait)
-                {
-                    const ActualOUTSVFGNode* actualOut = SVFUtil::cast<ActualOUTSVFGNode>(getSVFGNode(*ait));
-                    addInterIndirectVFRetEdge(formalOut,actualOut,getCallSiteID(cs, formalOut->getFun()));
-                }
-            }
-            NodeID def = getDef(formalOut->getMRVer());
-            addIntraIndirectVFEdge(def,nodeId, formalOut->getMRVer()->getMR()->getPointsTo());
+            if(LOADMU* mu = SVFUtil::dyn_cast<LOADMU>(*it))
+                addEdgeFromDef(mu->getMRVer());
         }
-        else if(const ActualINSVFGNode* actualIn = SVFUtil::dyn_cast<ActualINSVFGNode>(node))
+    }
+    else if(const StoreSVFGNode* storeNode = SVFUtil::dyn_cast<StoreSVFGNode>(node))
+    {
+        CHISet& chiSet = mssa->getCHISet(SVFUtil::cast<StoreStmt>(storeNode->getPAGEdge()));
+        for(CHISet::iterator it = chiSet.begin(), eit = chiSet.end(); it!=eit; ++it)
         {
-            const MRVer* ver = actualIn->getMRVer();
-            NodeID def = getDef(ver);
-            addIntraIndirectVFEdge(def,nodeId, ver->getMR()->getPointsTo());
+            if(STORECHI* chi = SVFUtil::dyn_cast<STORECHI>(*it))
+                addEdgeFromDef(chi->getOpVer());
         }
-        else if(SVFUtil::isa<ActualOUTSVFGNode>(node))
-        {
-            /// There's no need to connect actual out node to its definition site in the same function.
+    }
+    else if(const FormalOUTSVFGNode* formalOut = SVFUtil::dyn_cast<FormalOUTSVFGNode>(node))
+    {
+        addEdgeFromDef(formalOut->getMRVer());
+    }
+    else if(const ActualINSVFGNode* actualIn = SVFUtil::dyn_cast<ActualINSVFGNode>(node))
+    {
+        addEdgeFromDef(actualIn->getMRVer());
+    }
+    else if(SVFUtil::isa<ActualOUTSVFGNode>(node))
+    {
+        /// There's no need to connect actual out node to its definition site in the same function.
+    }
+    else if(const MSSAPHISVFGNode* phiNode = SVFUtil::dyn_cast<MSSAPHISVFGNode>(node))
+    {
+        for (MemSSA::PHI::OPVers::const_iterator it = phiNode->opVerBegin(), eit = phiNode->opVerEnd();
+                it != eit; it++)
+            addEdgeFromDef(it->second);
+    }
+}
+
+/*!
+ * Indirect edges from actual-ins to formal-ins and from formal-outs to actual-outs
+ */
+void SVFG::connectInterIndirectVFEdges(const SVFGNode* node)
+{
+    if(const FormalINSVFGNode* formalIn = SVFUtil::dyn_cast<FormalINSVFGNode>(node))
+    {
+        PTACallGraphEdge::CallInstSet callInstSet;
+        mssa->getPTA()->getPTACallGraph()->getDirCallSitesInvokingCallee(formalIn->getFun(),callInstSet);
+        for(PTACallGraphEdge::CallInstSet::iterator it = callInstSet.begin(), eit = callInstSet.end(); it!=eit; ++it)
+        {
+            const CallICFGNode* cs = *it;
+            if(!mssa->hasMU(cs))
+                continue;
+            ActualINSVFGNodeSet& actualIns = getActualINSVFGNodes(cs);
+            for(ActualINSVFGNodeSet::iterator ait = actualIns.begin(), aeit = actualIns.end(); ait!=aeit; ++ait)
+            {
+                const ActualINSVFGNode* actualIn = SVFUtil::cast<ActualINSVFGNode>(getSVFGNode(*ait));
+                addInterIndirectVFCallEdge(actualIn,formalIn,getCallSiteID(cs, formalIn->getFun()));
+            }
         }
-        else if(const MSSAPHISVFGNode* phiNode = SVFUtil::dyn_cast<MSSAPHISVFGNode>(node))
-        {
-            for (MemSSA::PHI::OPVers::const_iterator it = phiNode->opVerBegin(), eit = phiNode->opVerEnd();
-                    it != eit; it++)
+    }
+    else if(const FormalOUTSVFGNode* formalOut = SVFUtil::dyn_cast<FormalOUTSVFGNode>(node))
+    {
+        PTACallGraphEdge::CallInstSet callInstSet;
+        mssa->getPTA()->getPTACallGraph()->getDirCallSitesInvokingCallee(formalOut->getFun(),callInstSet);
+        for(PTACallGraphEdge::CallInstSet::iterator it = callInstSet.begin(), eit = callInstSet.end(); it!=eit; ++it)
+        {
+            const CallICFGNode* cs = *it;
+            if(!mssa->hasCHI(cs))
+                continue;
+            ActualOUTSVFGNodeSet& actualOuts = getActualOUTSVFGNodes(cs);
+            for(ActualOUTSVFGNodeSet::iterator ait = actualOuts.begin(), aeit = actualOuts.end(); ait!=aeit; ++ait)
             {
-                const MRVer* op = it->second;
-                NodeID def = getDef(op);
-                addIntraIndirectVFEdge(def,nodeId, op->getMR()->getPointsTo());
+                const ActualOUTSVFGNode* actualOut = SVFUtil::cast<ActualOUTSVFGNode>(getSVFGNode(*ait));
+                addInterIndirectVFRetEdge(formalOut,actualOut,getCallSiteID(cs, formalOut->getFun()));
             }
         }
     }
-
-
-    connectFromGlobalToProgEntry();
 }
 
 
@@ -573,7 +617,8 @@ SVFGEdge* SVFG::addInterIndirectVFRetEdge(const FormalOUTSVFGNode* src, const Ac
  */
 void SVFG::dump(const std::string& file, bool simple)
 {
-    GraphPrinter::WriteGraphToFile(outs(), file, this, simple);
+    ExportGraphToFile(outs(), file, this, simple, Options::DumpGraphFormat(),
+                      Options::DumpGraphColumns(), Options::DumpGraphThreads());
 }
 
 /**
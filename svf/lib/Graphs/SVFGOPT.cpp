@@ -474,11 +474,29 @@ bool SVFGOPT::checkSelfCycleEdges(const MSSAPHISVFGNode* node)
     return hasSelfCycle;
 }
 
+/// Kinds of the edges added when bypassing a node
+enum BypassEdgeKind
+{
+    IntraBypassEdge, CallBypassEdge, RetBypassEdge
+};
+
 /*!
- * Remove MSSAPHI node if possible
+ * Remove MSSAPHI node if possible.
+ * The edges from predecessors to successors are collected first, merging the
+ * points-to sets of the ones between the same nodes, so that each new edge is
+ * looked up in the graph only once. The node is kept if bypassing it would
+ * add more than -max-bypass-growth edges beyond the ones it removes.
  */
 void SVFGOPT::bypassMSSAPHINode(const MSSAPHISVFGNode* node)
 {
+    u32_t numOfInEdges = node->getInEdges().size();
+    u32_t numOfOutEdges = node->getOutEdges().size();
+    if (Options::MaxBypassGrowth() != 0
+            && numOfInEdges * numOfOutEdges > numOfInEdges + numOfOutEdges + Options::MaxBypassGrowth())
+        return;
+
+    Map<BypassEdgeKey, u32_t> keyToIndex;
+    std::vector<std::pair<BypassEdgeKey, NodeBS>> newEdges;
     SVFGNode::const_iterator inEdgeIt = node->InEdgeBegin();
     SVFGNode::const_iterator inEdgeEit = node->InEdgeEnd();
     for (; inEdgeIt != inEdgeEit; ++inEdgeIt)
@@ -494,15 +512,24 @@ void SVFGOPT::bypassMSSAPHINode(const MSSAPHISVFGNode* node)
         {
             const SVFGEdge* succEdge = *outEdgeIt;
             const SVFGNode* dstNode = (*outEdgeIt)->getDstNode();
-            if (srcNode->getId() != dstNode->getId()
-                    && addNewSVFGEdge(srcNode->getId(), dstNode->getId(), preEdge, succEdge))
-                added = true;
-            else
+
+            NodeBS intersection = SVFUtil::cast<IndirectSVFGEdge>(preEdge)->getPointsTo();
+            intersection &= SVFUtil::cast<IndirectSVFGEdge>(succEdge)->getPointsTo();
+            if (srcNode->getId() == dstNode->getId() || intersection.empty())
             {
                 /// if no new edge is added, the number of dst node's incoming edges may be decreased.
                 /// try to analyze it again.
                 addIntoWorklist(dstNode);
+                continue;
             }
+
+            added = true;
+            BypassEdgeKey key = getBypassEdgeKey(preEdge, succEdge);
+            auto inserted = keyToIndex.emplace(key, newEdges.size());
+            if (inserted.second)
+                newEdges.push_back(std::make_pair(key, intersection));
+            else
+                newEdges[inserted.first->second].second |= intersection;
         }
 
         if (added == false)
@@ -513,49 +540,55 @@ void SVFGOPT::bypassMSSAPHINode(const MSSAPHISVFGNode* node)
         }
     }
 
+    for (const std::pair<BypassEdgeKey, NodeBS>& newEdge : newEdges)
+    {
+        if (addNewSVFGEdge(newEdge.first, newEdge.second) == false)
+        {
+            /// the edge was there already, src and dst may both lose an edge
+            addIntoWorklist(getSVFGNode(newEdge.first.first.first));
+            addIntoWorklist(getSVFGNode(newEdge.first.first.second));
+        }
+    }
+
     removeAllEdges(node);
 }
 
 /*!
- * Add new SVFG edge from src to dst.
- * The edge's kind depends on preEdge and succEdge. Self-cycle edges may be added here.
+ * The new edge's kind depends on preEdge and succEdge.
  */
-bool SVFGOPT::addNewSVFGEdge(NodeID srcId, NodeID dstId, const SVFGEdge* preEdge, const SVFGEdge* succEdge)
+SVFGOPT::BypassEdgeKey SVFGOPT::getBypassEdgeKey(const SVFGEdge* preEdge, const SVFGEdge* succEdge) const
 {
     assert(SVFUtil::isa<IndirectSVFGEdge>(preEdge) && SVFUtil::isa<IndirectSVFGEdge>(succEdge)
            && "either pre or succ edge is not indirect SVFG edge");
-
-    const IndirectSVFGEdge* preIndEdge = SVFUtil::cast<IndirectSVFGEdge>(preEdge);
-    const IndirectSVFGEdge* succIndEdge = SVFUtil::cast<IndirectSVFGEdge>(succEdge);
-
-    NodeBS intersection = preIndEdge->getPointsTo();
-    intersection &= succIndEdge->getPointsTo();
-
-    if (intersection.empty())
-        return false;
-
     assert(bothInterEdges(preEdge, succEdge) == false && "both edges are inter edges");
 
+    NodePair srcDst = std::make_pair(preEdge->getSrcID(), succEdge->getDstID());
     if (const CallIndSVFGEdge* preCallEdge = SVFUtil::dyn_cast<CallIndSVFGEdge>(preEdge))
-    {
-        return addCallIndirectSVFGEdge(srcId, dstId, preCallEdge->getCallSiteId(), intersection);
-    }
+        return std::make_pair(srcDst, std::make_pair((u32_t) CallBypassEdge, preCallEdge->getCallSiteId()));
     else if (const CallIndSVFGEdge* succCallEdge = SVFUtil::dyn_cast<CallIndSVFGEdge>(succEdge))
-    {
-        return addCallIndirectSVFGEdge(srcId, dstId, succCallEdge->getCallSiteId(), intersection);
-    }
+        return std::make_pair(srcDst, std::make_pair((u32_t) CallBypassEdge, succCallEdge->getCallSiteId()));
     else if (const RetIndSVFGEdge* preRetEdge = SVFUtil::dyn_cast<RetIndSVFGEdge>(preEdge))
-    {
-        return addRetIndirectSVFGEdge(srcId, dstId, preRetEdge->getCallSiteId(), intersection);
-    }
+        return std::make_pair(srcDst, std::make_pair((u32_t) RetBypassEdge, preRetEdge->getCallSiteId()));
     else if (const RetIndSVFGEdge* succRetEdge = SVFUtil::dyn_cast<RetIndSVFGEdge>(succEdge))
-    {
-        return addRetIndirectSVFGEdge(srcId, dstId, succRetEdge->getCallSiteId(), intersection);
-    }
+        return std::make_pair(srcDst, std::make_pair((u32_t) RetBypassEdge, succRetEdge->getCallSiteId()));
     else
+        return std::make_pair(srcDst, std::make_pair((u32_t) IntraBypassEdge, (CallSiteID) 0));
+}
+
+/*!
+ * Add new SVFG edge from src to dst. Self-cycle edges may be added here.
+ */
+bool SVFGOPT::addNewSVFGEdge(const BypassEdgeKey& key, const NodeBS& cpts)
+{
+    NodeID srcId = key.first.first;
+    NodeID dstId = key.first.second;
+    switch (key.second.first)
     {
-        return addIntraIndirectVFEdge(srcId, dstId, intersection);
+    case CallBypassEdge:
+        return addCallIndirectSVFGEdge(srcId, dstId, key.second.second, cpts);
+    case RetBypassEdge:
+        return addRetIndirectSVFGEdge(srcId, dstId, key.second.second, cpts);
+    default:
+        return addIntraIndirectVFEdge(srcId, dstId, cpts);
     }
-
-    return false;
 }
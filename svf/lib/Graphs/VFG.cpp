@@ -33,6 +33,7 @@
 #include "Graphs/VFG.h"
 #include "SVFIR/SVFModule.h"
 #include "Util/SVFUtil.h"
+#include <thread>
 
 using namespace SVF;
 using namespace SVFUtil;
@@ -737,101 +738,49 @@ VFGEdge* VFG::addRetEdge(NodeID srcId, NodeID dstId, CallSiteID csId)
 
 
 /*!
- * Connect def-use chains for direct value-flow, (value-flow of top level pointers)
+ * Connect def-use chains for direct value-flow, (value-flow of top level pointers).
+ * With -vfg-build-threads, the edges within functions are collected by worker
+ * threads, each taking whole functions, and then added to the graph; the
+ * edges across functions are always added serially afterwards.
  */
 void VFG::connectDirectVFGEdges()
 {
-
-    for(iterator it = begin(), eit = end(); it!=eit; ++it)
+    if (Options::VFGBuildThreads() > 1)
     {
-        NodeID nodeId = it->first;
-        VFGNode* node = it->second;
-
-        if(StmtVFGNode* stmtNode = SVFUtil::dyn_cast<StmtVFGNode>(node))
-        {
-            /// do not handle AddrSVFG node, as it is already the source of a definition
-            if(SVFUtil::isa<AddrVFGNode>(stmtNode))
-                continue;
-            /// for all other cases, like copy/gep/load/ret, connect the RHS pointer to its def
-            if (stmtNode->getPAGSrcNode()->isConstDataOrAggDataButNotNullPtr() == false)
-                addIntraDirectVFEdge(getDef(stmtNode->getPAGSrcNode()), nodeId);
+        std::vector<std::vector<NodeID>> partitions;
+        partitionNodesByFunction(partitions);
 
-            /// for store, connect the RHS/LHS pointer to its def
-            if(SVFUtil::isa<StoreVFGNode>(stmtNode) && (stmtNode->getPAGDstNode()->isConstDataOrAggDataButNotNullPtr() == false))
-            {
-                addIntraDirectVFEdge(getDef(stmtNode->getPAGDstNode()), nodeId);
-            }
-
-        }
-        else if(PHIVFGNode* phiNode = SVFUtil::dyn_cast<PHIVFGNode>(node))
-        {
-            for (PHIVFGNode::OPVers::const_iterator it = phiNode->opVerBegin(), eit = phiNode->opVerEnd(); it != eit; it++)
-            {
-                if (it->second->isConstDataOrAggDataButNotNullPtr() == false)
-                    addIntraDirectVFEdge(getDef(it->second), nodeId);
-            }
-        }
-        else if(BinaryOPVFGNode* binaryNode = SVFUtil::dyn_cast<BinaryOPVFGNode>(node))
+        std::vector<std::vector<NodePair>> edgeBuffers(partitions.size());
+        auto worker = [this, &partitions, &edgeBuffers](const u32_t thread)
         {
-            for (BinaryOPVFGNode::OPVers::const_iterator it = binaryNode->opVerBegin(), eit = binaryNode->opVerEnd(); it != eit; it++)
-            {
-                if (it->second->isConstDataOrAggDataButNotNullPtr() == false)
-                    addIntraDirectVFEdge(getDef(it->second), nodeId);
-            }
-        }
-        else if(UnaryOPVFGNode* unaryNode = SVFUtil::dyn_cast<UnaryOPVFGNode>(node))
+            for (NodeID nodeId : partitions[thread])
+                getIntraDirectVFEdges(getVFGNode(nodeId), edgeBuffers[thread]);
+        };
+        std::vector<std::thread> workers;
+        for (u32_t i = 0; i < partitions.size(); ++i)
+            workers.push_back(std::thread(worker, i));
+        for (std::thread& t : workers)
+            t.join();
+
+        for (const std::vector<NodePair>& edges : edgeBuffers)
         {
-            for (UnaryOPVFGNode::OPVers::const_iterator it = unaryNode->opVerBegin(), eit = unaryNode->opVerEnd(); it != eit; it++)
-            {
-                if (it->second->isConstDataOrAggDataButNotNullPtr() == false)
-                    addIntraDirectVFEdge(getDef(it->second), nodeId);
-            }
-        }
-        else if(CmpVFGNode* cmpNode = SVFUtil::dyn_cast<CmpVFGNode>(node))
-        {
-            for (CmpVFGNode::OPVers::const_iterator it = cmpNode->opVerBegin(), eit = cmpNode->opVerEnd(); it != eit; it++)
-            {
-                if (it->second->isConstDataOrAggDataButNotNullPtr() == false)
-                    addIntraDirectVFEdge(getDef(it->second), nodeId);
-            }
+            for (const NodePair& edge : edges)
+                addIntraDirectVFEdge(edge.first, edge.second);
         }
-        else if(BranchVFGNode* branchNode = SVFUtil::dyn_cast<BranchVFGNode>(node))
-        {
-            const SVFVar* cond = branchNode->getBranchStmt()->getCondition();
-            if (cond->isConstDataOrAggDataButNotNullPtr() == false)
-                addIntraDirectVFEdge(getDef(cond), nodeId);
-        }
-        else if(ActualParmVFGNode* actualParm = SVFUtil::dyn_cast<ActualParmVFGNode>(node))
-        {
-            if (actualParm->getParam()->isConstDataOrAggDataButNotNullPtr() == false)
-                addIntraDirectVFEdge(getDef(actualParm->getParam()), nodeId);
-        }
-        else if(FormalParmVFGNode* formalParm = SVFUtil::dyn_cast<FormalParmVFGNode>(node))
+        for (iterator it = begin(), eit = end(); it != eit; ++it)
+            connectInterDirectVFEdges(it->second);
+    }
+    else
+    {
+        std::vector<NodePair> edges;
+        for (iterator it = begin(), eit = end(); it != eit; ++it)
         {
-            for(CallPESet::const_iterator it = formalParm->callPEBegin(), eit = formalParm->callPEEnd();
-                    it!=eit; ++it)
-            {
-                const CallICFGNode* cs = (*it)->getCallSite();
-                ActualParmVFGNode* acutalParm = getActualParmVFGNode((*it)->getRHSVar(),cs);
-                addInterEdgeFromAPToFP(acutalParm,formalParm,getCallSiteID(cs, formalParm->getFun()));
-            }
+            edges.clear();
+            getIntraDirectVFEdges(it->second, edges);
+            for (const NodePair& edge : edges)
+                addIntraDirectVFEdge(edge.first, edge.second);
+            connectInterDirectVFEdges(it->second);
         }
-        else if(FormalRetVFGNode* calleeRet = SVFUtil::dyn_cast<FormalRetVFGNode>(node))
-        {
-            /// connect formal ret to its definition node
-            addIntraDirectVFEdge(getDef(calleeRet->getRet()), nodeId);
-
-            /// connect formal ret to actual ret
-            for(RetPESet::const_iterator it = calleeRet->retPEBegin(), eit = calleeRet->retPEEnd(); it!=eit; ++it)
-            {
-                ActualRetVFGNode* callsiteRev = getActualRetVFGNode((*it)->getLHSVar());
-                const CallICFGNode* retBlockNode = (*it)->getCallSite();
-                CallICFGNode* callBlockNode = pag->getICFG()->getCallICFGNode(retBlockNode->getCallSite());
-                addInterEdgeFromFRToAR(calleeRet,callsiteRev, getCallSiteID(callBlockNode, calleeRet->getFun()));
-            }
-        }
-        /// Do not process FormalRetVFGNode, as they are connected by copy within callee
-        /// We assume one procedure only has unique return
     }
 
     /// connect direct value-flow edges (parameter passing) for thread fork/join
@@ -860,6 +809,134 @@ void VFG::connectDirectVFGEdges()
     }
 }
 
+/*!
+ * Direct def-use edges within a function. The graph is only read here, so
+ * this may run on worker threads.
+ */
+void VFG::getIntraDirectVFEdges(const VFGNode* node, std::vector<NodePair>& edges) const
+{
+    NodeID nodeId = node->getId();
+    auto addEdgeFromDef = [&](const PAGNode* var)
+    {
+        if (var->isConstDataOrAggDataButNotNullPtr() == false)
+            edges.push_back(std::make_pair(getDef(var), nodeId));
+    };
+
+    if(const StmtVFGNode* stmtNode = SVFUtil::dyn_cast<StmtVFGNode>(node))
+    {
+        /// do not handle AddrSVFG node, as it is already the source of a definition
+        if(SVFUtil::isa<AddrVFGNode>(stmtNode))
+            return;
+        /// for all other cases, like copy/gep/load/ret, connect the RHS pointer to its def
+        addEdgeFromDef(stmtNode->getPAGSrcNode());
+
+        /// for store, connect the RHS/LHS pointer to its def
+        if(SVFUtil::isa<StoreVFGNode>(stmtNode))
+            addEdgeFromDef(stmtNode->getPAGDstNode());
+    }
+    else if(const PHIVFGNode* phiNode = SVFUtil::dyn_cast<PHIVFGNode>(node))
+    {
+        for (PHIVFGNode::OPVers::const_iterator it = phiNode->opVerBegin(), eit = phiNode->opVerEnd(); it != eit; it++)
+            addEdgeFromDef(it->second);
+    }
+    else if(const BinaryOPVFGNode* binaryNode = SVFUtil::dyn_cast<BinaryOPVFGNode>(node))
+    {
+        for (BinaryOPVFGNode::OPVers::const_iterator it = binaryNode->opVerBegin(), eit = binaryNode->opVerEnd(); it != eit; it++)
+            addEdgeFromDef(it->second);
+    }
+    else if(const UnaryOPVFGNode* unaryNode = SVFUtil::dyn_cast<UnaryOPVFGNode>(node))
+    {
+        for (UnaryOPVFGNode::OPVers::const_iterator it = unaryNode->opVerBegin(), eit = unaryNode->opVerEnd(); it != eit; it++)
+            addEdgeFromDef(it->second);
+    }
+    else if(const CmpVFGNode* cmpNode = SVFUtil::dyn_cast<CmpVFGNode>(node))
+    {
+        for (CmpVFGNode::OPVers::const_iterator it = cmpNode->opVerBegin(), eit = cmpNode->opVerEnd(); it != eit; it++)
+            addEdgeFromDef(it->second);
+    }
+    else if(const BranchVFGNode* branchNode = SVFUtil::dyn_cast<BranchVFGNode>(node))
+    {
+        addEdgeFromDef(branchNode->getBranchStmt()->getCondition());
+    }
+    else if(const ActualParmVFGNode* actualParm = SVFUtil::dyn_cast<ActualParmVFGNode>(node))
+    {
+        addEdgeFromDef(actualParm->getParam());
+    }
+    else if(const FormalRetVFGNode* calleeRet = SVFUtil::dyn_cast<FormalRetVFGNode>(node))
+    {
+        /// connect formal ret to its definition node
+        edges.push_back(std::make_pair(getDef(calleeRet->getRet()), nodeId));
+    }
+}
+
+/*!
+ * Direct edges from actual to formal parameters and from formal to actual returns
+ */
+void VFG::connectInterDirectVFEdges(VFGNode* node)
+{
+    if(FormalParmVFGNode* formalParm = SVFUtil::dyn_cast<FormalParmVFGNode>(node))
+    {
+        for(CallPESet::const_iterator it = formalParm->callPEBegin(), eit = formalParm->callPEEnd();
+                it!=eit; ++it)
+        {
+            const CallICFGNode* cs = (*it)->getCallSite();
+            ActualParmVFGNode* acutalParm = getActualParmVFGNode((*it)->getRHSVar(),cs);
+            addInterEdgeFromAPToFP(acutalParm,formalParm,getCallSiteID(cs, formalParm->getFun()));
+        }
+    }
+    else if(FormalRetVFGNode* calleeRet = SVFUtil::dyn_cast<FormalRetVFGNode>(node))
+    {
+        /// connect formal ret to actual ret
+        for(RetPESet::const_iterator it = calleeRet->retPEBegin(), eit = calleeRet->retPEEnd(); it!=eit; ++it)
+        {
+            ActualRetVFGNode* callsiteRev = getActualRetVFGNode((*it)->getLHSVar());
+            const CallICFGNode* retBlockNode = (*it)->getCallSite();
+            CallICFGNode* callBlockNode = pag->getICFG()->getCallICFGNode(retBlockNode->getCallSite());
+            addInterEdgeFromFRToAR(calleeRet,callsiteRev, getCallSiteID(callBlockNode, calleeRet->getFun()));
+        }
+    }
+    /// We assume one procedure only has unique return
+}
+
+/*!
+ * Nodes are grouped by function, and the largest groups are handed out first,
+ * each to the partition with the fewest nodes so far.
+ */
+void VFG::partitionNodesByFunction(std::vector<std::vector<NodeID>>& partitions) const
+{
+    Map<const SVFFunction*, u32_t> funToGroup;
+    std::vector<std::vector<NodeID>> groups;
+    for (const_iterator it = begin(), eit = end(); it != eit; ++it)
+    {
+        const ICFGNode* icfgNode = it->second->getICFGNode();
+        const SVFFunction* fun = icfgNode ? icfgNode->getFun() : nullptr;
+        auto inserted = funToGroup.emplace(fun, groups.size());
+        if (inserted.second)
+            groups.emplace_back();
+        groups[inserted.first->second].push_back(it->first);
+    }
+
+    std::vector<u32_t> order(groups.size());
+    for (u32_t i = 0; i < order.size(); ++i)
+        order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&groups](u32_t lhs, u32_t rhs)
+    {
+        return groups[lhs].size() > groups[rhs].size();
+    });
+
+    partitions.clear();
+    partitions.resize(Options::VFGBuildThreads());
+    for (u32_t g : order)
+    {
+        std::vector<NodeID>& partition = *std::min_element(partitions.begin(), partitions.end(),
+                                         [](const std::vector<NodeID>& lhs, const std::vector<NodeID>& rhs)
+        {
+            return lhs.size() < rhs.size();
+        });
+        partition.insert(partition.end(), groups[g].begin(), groups[g].end());
+    }
+}
+
 /*!
  * Whether we has an intra VFG edge
  */
@@ -927,7 +1004,8 @@ VFGEdge* VFG::getIntraVFGEdge(const VFGNode* src, const VFGNode* dst, VFGEdge::V
  */
 void VFG::dump(const std::string& file, bool simple)
 {
-    GraphPrinter::WriteGraphToFile(outs(), file, this, simple);
+    ExportGraphToFile(outs(), file, this, simple, Options::DumpGraphFormat(),
+                      Options::DumpGraphColumns(), Options::DumpGraphThreads());
 }
 
 /*!
@@ -33,6 +33,7 @@
 #include "MTA/LockAnalysis.h"
 #include "Util/SVFUtil.h"
 #include "Util/PTAStat.h"
+#include <thread>
 
 using namespace SVF;
 using namespace SVFUtil;
@@ -134,6 +135,9 @@ void MHP::analyzeInterleaving()
     /// update non-candidate functions' interleaving
     updateNonCandidateFunInterleaving();
 
+    /// summarise the interleavings per instruction for pair queries
+    buildThreadInfoIndex();
+
     if (Options::PrintInterLev())
         printInterleaving();
 }
@@ -165,7 +169,8 @@ void MHP::updateNonCandidateFunInterleaving()
                         if (svfInst == entryinst)
                             continue;
                         CxtThreadStmt newCts(cts.getTid(), curCxt, svfInst);
-                        threadStmtToTheadInterLeav[newCts] |= threadStmtToTheadInterLeav[cts];
+                        NodeID newID = getCxtThreadStmtID(newCts);
+                        interleavingRows[newID] |= interleavingRows[getCxtThreadStmtID(cts)];
                         instToTSMap[svfInst].insert(newCts);
                     }
                 }
@@ -174,6 +179,62 @@ void MHP::updateNonCandidateFunInterleaving()
     }
 }
 
+/*!
+ * Summarise the thread statements of every instruction into bitsets so that
+ * an MHP query is a couple of bitset intersections instead of a scan over
+ * all pairs of thread statements. Instructions are independent, so the
+ * summaries are computed by -mhp-threads workers.
+ */
+void MHP::buildThreadInfoIndex()
+{
+    u32_t numOfThreads = tct->getTCTNodeNum();
+    std::vector<std::pair<const SVFInstruction*, InstThreadInfo*>> insts;
+    insts.reserve(instToTSMap.size());
+    instToThreadInfo.clear();
+    instToThreadInfo.reserve(instToTSMap.size());
+    for (const auto& it : instToTSMap)
+        insts.push_back(std::make_pair(it.first, &instToThreadInfo[it.first]));
+
+    auto summarise = [&](u32_t begin, u32_t end)
+    {
+        for (u32_t i = begin; i < end; ++i)
+        {
+            InstThreadInfo& info = *insts[i].second;
+            for (const CxtThreadStmt& cts : instToTSMap.at(insts[i].first))
+            {
+                NodeID tid = cts.getTid();
+                info.tids.set(tid);
+                if (isMultiForkedThread(tid))
+                    info.multiForkedTids.set(tid);
+                for (NodeID other : interleavingRows[ctsToID.at(cts)])
+                {
+                    if (other == tid)
+                        continue;
+                    info.pairs.set(tid * numOfThreads + other);
+                    info.revPairs.set(other * numOfThreads + tid);
+                }
+            }
+        }
+    };
+
+    u32_t numOfWorkers = std::max(1u, std::min((u32_t) Options::MHPThreads(), (u32_t) insts.size()));
+    if (numOfWorkers == 1)
+    {
+        summarise(0, insts.size());
+        return;
+    }
+    u32_t chunk = (insts.size() + numOfWorkers - 1) / numOfWorkers;
+    std::vector<std::thread> workers;
+    for (u32_t w = 0; w < numOfWorkers; ++w)
+    {
+        u32_t begin = std::min((u32_t) insts.size(), w * chunk);
+        u32_t end = std::min((u32_t) insts.size(), begin + chunk);
+        workers.push_back(std::thread(summarise, begin, end));
+    }
+    for (std::thread& worker : workers)
+        worker.join();
+}
+
 /*!
  * Handle call instruction in the current thread scope (excluding any fork site)
  */
@@ -545,34 +606,19 @@ bool MHP::mayHappenInParallelInst(const SVFInstruction* i1, const SVFInstruction
 {
 
     /// TODO: Any instruction in dead function is assumed no MHP with others
-    if (!hasThreadStmtSet(i1) || !hasThreadStmtSet(i2))
+    InstToThreadInfoMap::const_iterator it1 = instToThreadInfo.find(i1);
+    InstToThreadInfoMap::const_iterator it2 = instToThreadInfo.find(i2);
+    if (it1 == instToThreadInfo.end() || it2 == instToThreadInfo.end())
         return false;
 
-    const CxtThreadStmtSet& tsSet1 = getThreadStmtSet(i1);
-    const CxtThreadStmtSet& tsSet2 = getThreadStmtSet(i2);
-    for (const CxtThreadStmt& ts1 : tsSet1)
+    const InstThreadInfo& info1 = it1->second;
+    const InstThreadInfo& info2 = it2->second;
+    /// (1) t1 != t2, t2 \in l1 and t1 \in l2, i.e. (t1,t2) in pairs1 and (t2,t1) in pairs2
+    /// (2) t1 == t2 and t1 is multi-forked
+    if (info1.pairs.intersects(info2.revPairs) || info1.multiForkedTids.intersects(info2.tids))
     {
-        NodeBS l1 = getInterleavingThreads(ts1);
-        for (const CxtThreadStmt& ts2 : tsSet2)
-        {
-            NodeBS l2 = getInterleavingThreads(ts2);
-            if (ts1.getTid() != ts2.getTid())
-            {
-                if (l1.test(ts2.getTid()) && l2.test(ts1.getTid()))
-                {
-                    numOfMHPQueries++;
-                    return true;
-                }
-            }
-            else
-            {
-                if (isMultiForkedThread(ts1.getTid()))
-                {
-                    numOfMHPQueries++;
-                    return true;
-                }
-            }
-        }
+        numOfMHPQueries++;
+        return true;
     }
     return false;
 }
@@ -613,20 +659,15 @@ bool MHP::mayHappenInParallel(const SVFInstruction* i1, const SVFInstruction* i2
 
 bool MHP::executedByTheSameThread(const SVFInstruction* i1, const SVFInstruction* i2)
 {
-    if (!hasThreadStmtSet(i1) || !hasThreadStmtSet(i2))
+    InstToThreadInfoMap::const_iterator it1 = instToThreadInfo.find(i1);
+    InstToThreadInfoMap::const_iterator it2 = instToThreadInfo.find(i2);
+    if (it1 == instToThreadInfo.end() || it2 == instToThreadInfo.end())
         return true;
 
-    const CxtThreadStmtSet& tsSet1 = getThreadStmtSet(i1);
-    const CxtThreadStmtSet& tsSet2 = getThreadStmtSet(i2);
-    for (const CxtThreadStmt&ts1 : tsSet1)
-    {
-        for (const CxtThreadStmt& ts2 : tsSet2)
-        {
-            if (ts1.getTid() != ts2.getTid() || isMultiForkedThread(ts1.getTid()))
-                return false;
-        }
-    }
-    return true;
+    /// Both are executed by one and the same thread, which is not multi-forked
+    const InstThreadInfo& info1 = it1->second;
+    const InstThreadInfo& info2 = it2->second;
+    return info1.tids.count() == 1 && info1.tids == info2.tids && info1.multiForkedTids.empty();
 }
 
 /*!
@@ -634,12 +675,12 @@ bool MHP::executedByTheSameThread(const SVFInstruction* i1, const SVFInstruction
  */
 void MHP::printInterleaving()
 {
-    for (const auto& pair : threadStmtToTheadInterLeav)
+    for (const auto& pair : ctsToID)
     {
         outs() << "( t" << pair.first.getTid()
                << " , $" << pair.first.getStmt()->getSourceLoc()
                << "$" << pair.first.getStmt()->toString() << " ) ==> [";
-        for (unsigned i : pair.second)
+        for (unsigned i : interleavingRows[pair.second])
         {
             outs() << " " << i << " ";
         }
@@ -110,6 +110,9 @@ void PointerAnalysis::initialize()
     svfMod = pag->getModule();
     chgraph = pag->getCHG();
 
+    /// build the function bodies skipped by a lazy SVFIR build (-lazy-svfir)
+    pag->materializeReachableFunctions();
+
     /// initialise pta call graph for every pointer analysis instance
     if(Options::EnableThreadCallGraph())
     {
@@ -48,40 +48,45 @@ BVDataPTAImpl::BVDataPTAImpl(SVFIR* p, PointerAnalysis::PTATY type, bool alias_c
 {
     if (type == Andersen_BASE || type == Andersen_WPA || type == AndersenWaveDiff_WPA
             || type == TypeCPP_WPA || type == FlowS_DDA
-            || type == AndersenSCD_WPA || type == AndersenSFR_WPA || type == CFLFICI_WPA || type == CFLFSCS_WPA)
+            || type == AndersenSCD_WPA || type == AndersenSFR_WPA || type == AndersenLCD_WPA
+            || type == AndersenHCD_WPA || type == CFLFICI_WPA || type == CFLFSCS_WPA)
     {
         // Only maintain reverse points-to when the analysis is field-sensitive, as objects turning
         // field-insensitive is all it is used for.
         bool maintainRevPts = Options::MaxFieldLimit() != 0;
-        if (Options::ptDataBacking() == PTBackingType::Mutable) ptD = std::make_unique<MutDiffPTDataTy>(maintainRevPts);
+        // Only flow-sensitive IN/OUT sets are spilled; the rest of the spilled backing is mutable.
+        if (Options::ptDataBacking() == PTBackingType::Mutable || Options::ptDataBacking() == PTBackingType::Spilled) ptD = std::make_unique<MutDiffPTDataTy>(maintainRevPts);
         else if (Options::ptDataBacking() == PTBackingType::Persistent) ptD = std::make_unique<PersDiffPTDataTy>(getPtCache(), maintainRevPts);
         else assert(false && "BVDataPTAImpl::BVDataPTAImpl: unexpected points-to backing type!");
     }
     else if (type == Steensgaard_WPA)
     {
         // Steensgaard is only field-insensitive (for now?), so no reverse points-to.
-        if (Options::ptDataBacking() == PTBackingType::Mutable) ptD = std::make_unique<MutDiffPTDataTy>(false);
+        if (Options::ptDataBacking() == PTBackingType::Mutable || Options::ptDataBacking() == PTBackingType::Spilled) ptD = std::make_unique<MutDiffPTDataTy>(false);
         else if (Options::ptDataBacking() == PTBackingType::Persistent) ptD = std::make_unique<PersDiffPTDataTy>(getPtCache(), false);
         else assert(false && "BVDataPTAImpl::BVDataPTAImpl: unexpected points-to backing type!");
     }
     else if (type == FSSPARSE_WPA)
     {
+        spillFile.setPath(Options::PtdSpillFile());
         if (Options::INCDFPTData())
         {
             if (Options::ptDataBacking() == PTBackingType::Mutable) ptD = std::make_unique<MutIncDFPTDataTy>(false);
             else if (Options::ptDataBacking() == PTBackingType::Persistent) ptD = std::make_unique<PersIncDFPTDataTy>(getPtCache(), false);
+            else if (Options::ptDataBacking() == PTBackingType::Spilled) ptD = std::make_unique<SpillIncDFPTDataTy>(getSpillFile(), (u64_t)Options::PtdBudget() << 20, false, PTDataTy::SpillIncDataFlow);
             else assert(false && "BVDataPTAImpl::BVDataPTAImpl: unexpected points-to backing type!");
         }
         else
         {
             if (Options::ptDataBacking() == PTBackingType::Mutable) ptD = std::make_unique<MutDFPTDataTy>(false);
             else if (Options::ptDataBacking() == PTBackingType::Persistent) ptD = std::make_unique<PersDFPTDataTy>(getPtCache(), false);
+            else if (Options::ptDataBacking() == PTBackingType::Spilled) ptD = std::make_unique<SpillDFPTDataTy>(getSpillFile(), (u64_t)Options::PtdBudget() << 20, false);
             else assert(false && "BVDataPTAImpl::BVDataPTAImpl: unexpected points-to backing type!");
         }
     }
     else if (type == VFS_WPA)
     {
-        if (Options::ptDataBacking() == PTBackingType::Mutable) ptD = std::make_unique<MutVersionedPTDataTy>(false);
+        if (Options::ptDataBacking() == PTBackingType::Mutable || Options::ptDataBacking() == PTBackingType::Spilled) ptD = std::make_unique<MutVersionedPTDataTy>(false);
         else if (Options::ptDataBacking() == PTBackingType::Persistent) ptD = std::make_unique<PersVersionedPTDataTy>(getPtCache(), false);
         else assert(false && "BVDataPTAImpl::BVDataPTAImpl: unexpected points-to backing type!");
     }
@@ -125,6 +130,13 @@ void BVDataPTAImpl::finalize()
         SVFUtil::outs().flush();
     }
 
+    if (SVFUtil::isa<SpillDFPTDataTy>(ptD.get()) && print_stat)
+    {
+        SVFUtil::outs() << "\n****Spilled Points-To Statistics: " << PTAName() << "****\n";
+        spillFile.printStats();
+        SVFUtil::outs() << "#######################################################" << std::endl;
+        SVFUtil::outs().flush();
+    }
 }
 
 /*!
@@ -159,6 +171,48 @@ void BVDataPTAImpl::remapPointsToSets(void)
     getPTDataTy()->remapAllPts();
 }
 
+/*!
+ * Hash-cons the final points-to sets into a FrozenPTData and drop the solving data
+ */
+void BVDataPTAImpl::freezePointsTo()
+{
+    if (!SVFUtil::isa<DiffPTDataTy>(ptD.get()) && !SVFUtil::isa<DFPTDataTy>(ptD.get()))
+        return;
+
+    u32_t numPtsBefore = 0, numElementsBefore = 0;
+    std::unique_ptr<FrozenPTDataTy> frozen = std::make_unique<FrozenPTDataTy>();
+    for (SVFIR::iterator it = pag->begin(), eit = pag->end(); it != eit; ++it)
+    {
+        const PointsTo &pts = ptD->getPts(it->first);
+        if (pts.empty()) continue;
+
+        ++numPtsBefore;
+        numElementsBefore += pts.count();
+        frozen->freezePts(it->first, pts);
+    }
+
+    frozen->finishFreezing();
+    ptD = std::move(frozen);
+    // Every set now lives in the frozen pool; the cache only held solving state.
+    ptCache.reset();
+    Map<const CallICFGNode*, PointsTo>().swap(resolvedIndCallPts);
+
+    if (print_stat)
+    {
+        const FrozenPTDataTy *frozenPtD = SVFUtil::cast<FrozenPTDataTy>(ptD.get());
+
+        static const unsigned fieldWidth = 25;
+        SVFUtil::outs() << "\n****Frozen Points-To Statistics: " << PTAName() << "****\n";
+        SVFUtil::outs().flags(std::ios::left);
+        SVFUtil::outs() << std::setw(fieldWidth) << "PointersWithPts"    << numPtsBefore                      << "\n";
+        SVFUtil::outs() << std::setw(fieldWidth) << "ElementsBefore"     << numElementsBefore                 << "\n";
+        SVFUtil::outs() << std::setw(fieldWidth) << "UniquePointsToSets" << frozenPtD->getNumUniquePts()      << "\n";
+        SVFUtil::outs() << std::setw(fieldWidth) << "ElementsAfter"      << frozenPtD->getNumStoredElements() << "\n";
+        SVFUtil::outs() << "#######################################################" << std::endl;
+        SVFUtil::outs().flush();
+    }
+}
+
 void BVDataPTAImpl::writeObjVarToFile(const string& filename)
 {
     outs() << "Storing ObjVar to '" << filename << "'...";
@@ -455,22 +509,43 @@ void BVDataPTAImpl::dumpAllPts()
  * On the fly call graph construction
  * callsites is candidate indirect callsites need to be analyzed based on points-to results
  * newEdges is the new indirect call edges discovered
+ *
+ * Resolution is monotone in the points-to set of the function (or vtable) pointer,
+ * so with -incremental-cg only the targets added since the callsite was last
+ * resolved are looked at, and callsites whose pointer did not change are skipped.
  */
 void BVDataPTAImpl::onTheFlyCallGraphSolve(const CallSiteToFunPtrMap& callsites, CallEdgeMap& newEdges)
 {
     for(CallSiteToFunPtrMap::const_iterator iter = callsites.begin(), eiter = callsites.end(); iter!=eiter; ++iter)
     {
         const CallICFGNode* cs = iter->first;
+        const bool isVirtualCall = SVFUtil::getSVFCallSite(cs->getCallSite()).isVirtualCall();
 
-        if (SVFUtil::getSVFCallSite(cs->getCallSite()).isVirtualCall())
+        NodeID ptr = iter->second;
+        if (isVirtualCall)
         {
             const SVFValue* vtbl = SVFUtil::getSVFCallSite(cs->getCallSite()).getVtablePtr();
             assert(pag->hasValueNode(vtbl));
-            NodeID vtblId = pag->getValueNode(vtbl);
-            resolveCPPIndCalls(cs, getPts(vtblId), newEdges);
+            ptr = pag->getValueNode(vtbl);
         }
-        else
-            resolveIndCalls(iter->first,getPts(iter->second),newEdges);
+
+        // CHA-based virtual call resolution ignores the points-to set.
+        if (!Options::IncrementalCallGraph() || (isVirtualCall && Options::ConnectVCallOnCHA()))
+        {
+            if (isVirtualCall) resolveCPPIndCalls(cs, getPts(ptr), newEdges);
+            else resolveIndCalls(cs, getPts(ptr), newEdges);
+            continue;
+        }
+
+        PointsTo& resolved = resolvedIndCallPts[cs];
+        PointsTo delta;
+        delta.intersectWithComplement(getPts(ptr), resolved);
+        if (delta.empty())
+            continue;
+
+        resolved |= delta;
+        if (isVirtualCall) resolveCPPIndCalls(cs, delta, newEdges);
+        else resolveIndCalls(cs, delta, newEdges);
     }
 }
 
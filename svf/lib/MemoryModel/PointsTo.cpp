@@ -342,14 +342,16 @@ PointsTo::MappingPtr PointsTo::getNodeMapping() const
 NodeID PointsTo::getInternalNode(NodeID n) const
 {
     if (nodeMapping == nullptr) return n;
-    assert(n < nodeMapping->size());
+    // Nodes allocated after the mapping was computed (e.g., GEP objects
+    // created during solving) keep their ID.
+    if (n >= nodeMapping->size()) return n;
     return nodeMapping->at(n);
 }
 
 NodeID PointsTo::getExternalNode(NodeID n) const
 {
     if (reverseNodeMapping == nullptr) return n;
-    assert(n < reverseNodeMapping->size());
+    if (n >= reverseNodeMapping->size()) return n;
     return reverseNodeMapping->at(n);
 }
 
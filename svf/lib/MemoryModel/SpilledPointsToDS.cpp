@@ -0,0 +1,142 @@
+//===- SpilledPointsToDS.cpp -- Spill file of out-of-core points-to sets ------//
+
+/*
+ * SpilledPointsToDS.cpp
+ *
+ * The file backing SpilledDFPTData (implementation).
+ */
+
+#include "MemoryModel/SpilledPointsToDS.h"
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+
+using namespace SVF;
+using namespace SVFUtil;
+
+PointsToSpillFile::~PointsToSpillFile()
+{
+    if (base != nullptr) munmap(base, capacity);
+    if (fd >= 0)
+    {
+        close(fd);
+        // The anonymous file was unlinked when it was created.
+        if (!path.empty()) unlink(path.c_str());
+    }
+}
+
+/*!
+ * Create the file: at path if one was given, otherwise a temporary file
+ * which is unlinked right away so it disappears with the process.
+ */
+void PointsToSpillFile::open()
+{
+    if (path.empty())
+    {
+        const char* tmpDir = getenv("TMPDIR");
+        std::string tmpl = std::string(tmpDir != nullptr && tmpDir[0] != '\0' ? tmpDir : "/tmp") + "/svf-pts-XXXXXX";
+        std::vector<char> name(tmpl.begin(), tmpl.end());
+        name.push_back('\0');
+        fd = mkstemp(name.data());
+        if (fd >= 0) unlink(name.data());
+    }
+    else
+    {
+        fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+    }
+
+    if (fd < 0)
+    {
+        errs() << errMsg("cannot create points-to spill file ")
+               << (path.empty() ? "in $TMPDIR" : path) << ": " << strerror(errno) << "\n";
+        abort();
+    }
+}
+
+/*!
+ * Enlarge the file to at least minCapacity bytes and map it again.
+ */
+void PointsToSpillFile::grow(u64_t minCapacity)
+{
+    if (fd < 0) open();
+
+    u64_t newCapacity = std::max<u64_t>(capacity * 2, 1 << 20);
+    while (newCapacity < minCapacity) newCapacity *= 2;
+
+    if (ftruncate(fd, newCapacity) != 0)
+    {
+        errs() << errMsg("cannot grow points-to spill file to ") << newCapacity << " bytes: " << strerror(errno) << "\n";
+        abort();
+    }
+
+    if (base != nullptr) munmap(base, capacity);
+    void* mapped = mmap(nullptr, newCapacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapped == MAP_FAILED)
+    {
+        errs() << errMsg("cannot map points-to spill file: ") << strerror(errno) << "\n";
+        abort();
+    }
+
+    base = static_cast<unsigned char*>(mapped);
+    capacity = newCapacity;
+}
+
+PointsToSpillFile::Offset PointsToSpillFile::write(const unsigned char* data, size_t size)
+{
+    const u64_t extent = extentSize(size);
+    Offset offset;
+
+    // Best fit among the freed extents, else append.
+    std::multimap<u64_t, Offset>::iterator fit = freeExtents.lower_bound(extent);
+    if (fit != freeExtents.end())
+    {
+        offset = fit->second;
+        const u64_t rest = fit->first - extent;
+        freeExtents.erase(fit);
+        if (rest != 0) freeExtents.emplace(rest, offset + extent);
+    }
+    else
+    {
+        if (end + extent > capacity) grow(end + extent);
+        offset = end;
+        end += extent;
+    }
+
+    memcpy(base + offset, data, size);
+    liveBytes += extent;
+    return offset;
+}
+
+void PointsToSpillFile::release(Offset offset, size_t size)
+{
+    const u64_t extent = extentSize(size);
+    assert(offset + extent <= end && "PointsToSpillFile::release: extent out of range!");
+    liveBytes -= extent;
+
+    if (offset + extent == end) end = offset;
+    else freeExtents.emplace(extent, offset);
+}
+
+void PointsToSpillFile::printStats() const
+{
+    static const unsigned fieldWidth = 25;
+    SVFUtil::outs().flags(std::ios::left);
+
+    SVFUtil::outs() << std::setw(fieldWidth) << "BudgetBytes"       << budgetBytes       << "\n";
+    SVFUtil::outs() << std::setw(fieldWidth) << "ResidentBytes"     << residentBytes     << "\n";
+    SVFUtil::outs() << std::setw(fieldWidth) << "PeakResidentBytes" << peakResidentBytes << "\n";
+
+    SVFUtil::outs() << std::setw(fieldWidth) << "Spills"            << numSpills         << "\n";
+    SVFUtil::outs() << std::setw(fieldWidth) << "Faults"            << numFaults         << "\n";
+    SVFUtil::outs() << std::setw(fieldWidth) << "SpilledSetBytes"   << spilledSetBytes   << "\n";
+    SVFUtil::outs() << std::setw(fieldWidth) << "SpilledBytes"      << spilledBytes      << "\n";
+
+    SVFUtil::outs() << std::setw(fieldWidth) << "LiveSpillBytes"    << liveBytes         << "\n";
+    SVFUtil::outs() << std::setw(fieldWidth) << "SpillFileBytes"    << capacity          << "\n";
+
+    SVFUtil::outs().flush();
+}
@@ -45,11 +45,21 @@ u32_t ContextCond::maximumCxt = 0;
 u32_t ContextCond::maximumPathLen = 0;
 u32_t ContextCond::maximumPath = 0;
 u32_t SaberCondAllocator::totalCondNum = 0;
+bool SaberCondition::bddBackend = false;
+
+const Z3Expr& SaberCondition::nullZ3Expr()
+{
+    static const Z3Expr* null = new Z3Expr(Z3Expr::nullExpr());
+    return *null;
+}
 
 
 SaberCondAllocator::SaberCondAllocator()
 {
-
+    /// all conditions of a run share one backend
+    assert((totalCondNum == 0 || SaberCondition::isBDDBackend() == Options::SaberBDD()) &&
+           "path condition backend changed after conditions were allocated");
+    SaberCondition::setBDDBackend(Options::SaberBDD());
 }
 
 /*!
@@ -597,7 +607,8 @@ void SaberCondAllocator::printPathCond()
 SaberCondAllocator::Condition SaberCondAllocator::newCond(const SVFInstruction* inst)
 {
     u32_t condCountIdx = totalCondNum++;
-    Condition expr = Condition::getContext().bool_const(("c" + std::to_string(condCountIdx)).c_str());
+    Condition expr = SaberCondition::isBDDBackend() ? Condition(BDDExpr::var(condCountIdx)) :
+                     Condition(Z3Expr(Condition::getContext().bool_const(("c" + std::to_string(condCountIdx)).c_str())));
     Condition negCond = Condition::NEG(expr);
     setCondInst(expr, inst);
     setNegCondInst(negCond, inst);
@@ -606,32 +617,152 @@ SaberCondAllocator::Condition SaberCondAllocator::newCond(const SVFInstruction*
     return expr;
 }
 
+/// Whether cond is the negation of other
+static inline bool isNegationOf(const z3::expr& cond, const z3::expr& other)
+{
+    return cond.is_app() && cond.decl().decl_kind() == Z3_OP_NOT && cond.arg(0).id() == other.id();
+}
+
+/// Whether cond is true, false, a boolean variable or a negated boolean variable
+static inline bool isLiteral(const z3::expr& cond)
+{
+    if (cond.is_app() && cond.decl().decl_kind() == Z3_OP_NOT)
+        return cond.arg(0).is_const() && cond.arg(0).decl().decl_kind() == Z3_OP_UNINTERPRETED;
+    return cond.is_const() && (cond.is_true() || cond.is_false() || cond.decl().decl_kind() == Z3_OP_UNINTERPRETED);
+}
+
+/*!
+ * Each query asserts (p => formula) for a fresh literal p and checks under
+ * the assumption p, so the solver keeps what it has learnt across queries
+ * instead of discarding it on every push/pop. p is then fixed to false,
+ * which disables the implication for later queries.
+ */
+z3::check_result SaberCondAllocator::checkUnderAssumption(const z3::expr& formula) const
+{
+    if (querySolver == nullptr)
+        querySolver = new z3::solver(Condition::getContext());
+    else if (numOfAssumptionLits >= maxAssumptionLits)
+    {
+        querySolver->reset();
+        numOfAssumptionLits = 0;
+    }
+    numOfSolverCalls++;
+
+    z3::context& ctx = Condition::getContext();
+    z3::expr assumption = ctx.bool_const(("pc_query_" + std::to_string(numOfSolverCalls)).c_str());
+    numOfAssumptionLits++;
+    querySolver->add(z3::implies(assumption, formula));
+    z3::expr_vector assumptions(ctx);
+    assumptions.push_back(assumption);
+    z3::check_result res = querySolver->check(assumptions);
+    querySolver->add(!assumption);
+    return res;
+}
+
 /// Whether lhs and rhs are equivalent branch conditions
 bool SaberCondAllocator::isEquivalentBranchCond(const Condition &lhs,
         const Condition &rhs) const
 {
-    Condition::getSolver().push();
-    Condition::getSolver().add(lhs.getExpr() != rhs.getExpr()); /// check equal using z3 solver
-    z3::check_result res = Condition::getSolver().check();
-    Condition::getSolver().pop();
-    return res == z3::unsat;
+    numOfEquivQueries++;
+    /// BDDs are canonical: equivalent conditions are the same node
+    if (SaberCondition::isBDDBackend())
+    {
+        numOfSyntacticAnswers++;
+        return lhs.id() == rhs.id();
+    }
+    const z3::expr& l = lhs.getExpr();
+    const z3::expr& r = rhs.getExpr();
+    /// Z3 expressions are hash-consed: the same id means the same formula
+    if (l.id() == r.id())
+    {
+        numOfSyntacticAnswers++;
+        return true;
+    }
+    /// two different constants, or x and !x
+    if (((l.is_true() || l.is_false()) && (r.is_true() || r.is_false())) || isNegationOf(l, r) || isNegationOf(r, l))
+    {
+        numOfSyntacticAnswers++;
+        return false;
+    }
+
+    std::pair<u32_t, u32_t> key = l.id() < r.id() ? std::make_pair(l.id(), r.id()) : std::make_pair(r.id(), l.id());
+    EquivQueryCache::const_iterator it = equivQueryCache.find(key);
+    if (it != equivQueryCache.end())
+    {
+        numOfCacheHits++;
+        return it->second.equivalent;
+    }
+
+    bool equivalent = checkUnderAssumption(l != r) == z3::unsat; /// check equal using z3 solver
+    equivQueryCache[key] = EquivQuery{lhs, rhs, equivalent};
+    return equivalent;
 }
 
 /// whether condition is satisfiable
 bool SaberCondAllocator::isSatisfiable(const Condition &condition)
 {
-    Condition::getSolver().add(condition.getExpr());
-    z3::check_result result = Condition::getSolver().check();
-    Condition::getSolver().pop();
-    if (result == z3::sat || result == z3::unknown)
-        return true;
-    else
-        return false;
+    numOfSatQueries++;
+    /// only the false BDD is unsatisfiable
+    if (SaberCondition::isBDDBackend())
+    {
+        numOfSyntacticAnswers++;
+        return !condition.getBDDExpr().isFalse();
+    }
+    const z3::expr& c = condition.getExpr();
+    if (isLiteral(c))
+    {
+        numOfSyntacticAnswers++;
+        return !c.is_false();
+    }
+
+    SatQueryCache::const_iterator it = satQueryCache.find(c.id());
+    if (it != satQueryCache.end())
+    {
+        numOfCacheHits++;
+        return it->second.satisfiable;
+    }
+
+    z3::check_result result = checkUnderAssumption(c);
+    bool satisfiable = result == z3::sat || result == z3::unknown;
+    satQueryCache[c.id()] = SatQuery{condition, satisfiable};
+    return satisfiable;
+}
+
+void SaberCondAllocator::printQueryStat() const
+{
+    u32_t numOfQueries = numOfEquivQueries + numOfSatQueries;
+    double hitRate = numOfQueries == 0 ? 0 : 100.0 * (numOfSyntacticAnswers + numOfCacheHits) / numOfQueries;
+    outs() << "Path condition queries: " << numOfQueries << " (equivalence: " << numOfEquivQueries
+           << ", satisfiability: " << numOfSatQueries << ")\n";
+    outs() << "Answered syntactically: " << numOfSyntacticAnswers << "\n";
+    outs() << "Answered from cache: " << numOfCacheHits << "\n";
+    outs() << "Z3 solver calls: " << numOfSolverCalls << "\n";
+    outs() << "Query hit rate: " << hitRate << "%\n";
+    if (SaberCondition::isBDDBackend())
+    {
+        const BDDManager& mgr = BDDManager::getManager();
+        double opHitRate = mgr.numOfCacheLookups == 0 ? 0 : 100.0 * mgr.numOfCacheHits / mgr.numOfCacheLookups;
+        outs() << "BDD live nodes: " << mgr.numOfLiveNodes << " (peak: " << mgr.peakLiveNodes << ")\n";
+        outs() << "BDD garbage collections: " << mgr.numOfGCs << "\n";
+        outs() << "BDD operation cache hit rate: " << opHitRate << "%\n";
+    }
 }
 
 /// extract subexpression from a Z3 expression
 void SaberCondAllocator::extractSubConds(const Condition &condition, NodeBS &support) const
 {
+    /// the positive and negative literals of the variables on some path to true
+    if (SaberCondition::isBDDBackend())
+    {
+        Set<std::pair<u32_t, bool>> literals;
+        condition.getBDDExpr().getSatLiterals(literals);
+        for (const std::pair<u32_t, bool>& lit : literals)
+        {
+            BDDExpr var = BDDExpr::var(lit.first);
+            support.set(lit.second ? var.id() : BDDExpr::NEG(var).id());
+        }
+        return;
+    }
     if (condition.getExpr().num_args() == 1 && isNegCond(condition.id()))
     {
         support.set(condition.getExpr().id());
@@ -642,7 +773,7 @@ void SaberCondAllocator::extractSubConds(const Condition &condition, NodeBS &sup
             support.set(condition.getExpr().id());
     for (u32_t i = 0; i < condition.getExpr().num_args(); ++i)
     {
-        Condition expr = condition.getExpr().arg(i);
+        Condition expr = Z3Expr(condition.getExpr().arg(i));
         extractSubConds(expr, support);
     }
 
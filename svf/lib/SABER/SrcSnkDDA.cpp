@@ -41,6 +41,8 @@ using namespace SVFUtil;
 void SrcSnkDDA::initialize(SVFModule* module)
 {
     SVFIR* pag = PAG::getPAG();
+    /// sources and sinks are collected from the SVFIR, so materialize it first under -lazy-svfir
+    pag->materializeReachableFunctions();
 
     AndersenWaveDiff* ander = AndersenWaveDiff::createAndersenWaveDiff(pag);
     if(Options::SABERFULLSVFG())
@@ -97,8 +99,10 @@ void SrcSnkDDA::analyze(SVFModule* module)
             if(Options::DumpSlice())
                 annotateSlice(_curSlice);
 
+            double guardStart = SVFStat::getClk();
             if(_curSlice->AllPathReachableSolve())
                 _curSlice->setAllReachable();
+            guardTime += (SVFStat::getClk() - guardStart) / TIMEINTERVAL;
 
             DBOUT(DSaber, outs() << "Guard computation for slice:" << (*iter)->getId() << ")\n");
         }
@@ -299,9 +303,18 @@ void SrcSnkDDA::dumpSlices()
         const_cast<SVFG*>(getSVFG())->dump("Slice",true);
 }
 
+void SrcSnkDDA::finalize()
+{
+    dumpSlices();
+    if (Options::PStat())
+        printZ3Stat();
+}
+
 void SrcSnkDDA::printZ3Stat()
 {
 
     outs() << "Z3 Mem usage: " << getSaberCondAllocator()->getMemUsage() << "\n";
     outs() << "Z3 Number: " << getSaberCondAllocator()->getCondNum() << "\n";
+    outs() << "Guard computation time: " << guardTime << "s\n";
+    getSaberCondAllocator()->printQueryStat();
 }
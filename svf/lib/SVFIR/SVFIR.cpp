@@ -29,6 +29,7 @@
 
 #include "Util/Options.h"
 #include "SVFIR/SVFIR.h"
+#include "Util/WorkList.h"
 
 using namespace SVF;
 using namespace SVFUtil;
@@ -664,6 +665,91 @@ void SVFIR::initialiseCandidatePointers()
         candidatePointers.insert(nodeId);
     }
 }
+
+/*!
+ * Whether the ICFG nodes and SVFStmts of a function have been built
+ */
+bool SVFIR::isMaterialized(const SVFFunction* fun)
+{
+    if (!isLazilyBuilt())
+        return true;
+    std::lock_guard<std::mutex> lock(materializeMutex);
+    return materializedFuns.find(fun) != materializedFuns.end();
+}
+
+/*!
+ * Build the ICFG nodes and SVFStmts of a function if this has not been done yet
+ */
+void SVFIR::materializeFunction(const SVFFunction* fun)
+{
+    if (!isLazilyBuilt())
+        return;
+    std::lock_guard<std::mutex> lock(materializeMutex);
+    if (materializedFuns.insert(fun).second)
+        funMaterializer(fun);
+}
+
+/*!
+ * Materialize the functions an analysis starting from the program entry may visit:
+ * the transitive direct callees of main and of every address-taken function
+ * (the possible targets of indirect calls and thread forks).
+ * Without a program entry, every function is materialized.
+ */
+void SVFIR::materializeReachableFunctions()
+{
+    if (!isLazilyBuilt())
+        return;
+
+    const SVFFunction* entry = SVFUtil::getProgEntryFunction(svfModule);
+    if (entry == nullptr)
+    {
+        materializeAllFunctions();
+        return;
+    }
+
+    FIFOWorkList<const SVFFunction*> worklist;
+    worklist.push(entry);
+    for (const SVFFunction* fun : *svfModule)
+    {
+        if (fun->hasAddressTaken())
+            worklist.push(fun);
+    }
+
+    Set<const SVFFunction*> visited;
+    while (!worklist.empty())
+    {
+        const SVFFunction* fun = worklist.pop();
+        if (visited.insert(fun).second == false)
+            continue;
+        materializeFunction(fun);
+        for (const SVFBasicBlock* bb : fun->getBasicBlockList())
+        {
+            for (const SVFInstruction* inst : bb->getInstructionList())
+            {
+                if (!SVFUtil::isNonInstricCallSite(inst))
+                    continue;
+                if (const SVFFunction* callee = SVFUtil::getCallee(inst))
+                    worklist.push(callee->getDefFunForMultipleModule());
+            }
+        }
+    }
+
+    initialiseCandidatePointers();
+    setNodeNumAfterPAGBuild(getTotalNodeNum());
+}
+
+/*!
+ * Materialize every function of the module
+ */
+void SVFIR::materializeAllFunctions()
+{
+    if (!isLazilyBuilt())
+        return;
+    for (const SVFFunction* fun : *svfModule)
+        materializeFunction(fun);
+    initialiseCandidatePointers();
+    setNodeNumAfterPAGBuild(getTotalNodeNum());
+}
 /*!
  * Return true if FIObjVar can point to any object
  * Or a field GepObjVar can point to any object.
@@ -4,6 +4,24 @@
 using namespace SVF;
 using namespace SVFUtil;
 
+SVFValue::SourceLocResolver SVFValue::sourceLocResolver = nullptr;
+
+/*!
+ * Resolve the source code information on first access.
+ * Values created without a front-end resolver have no source code information.
+ */
+const std::string& SVFValue::getSourceLoc() const
+{
+    if (sourceLoc == nullptr)
+    {
+        if (sourceLocResolver)
+            sourceLoc = &StringPool::intern(sourceLocResolver(this));
+        else
+            sourceLoc = &StringPool::intern("No source code Info");
+    }
+    return *sourceLoc;
+}
+
 /// Add field (index and offset) with its corresponding type
 void StInfo::addFldWithType(u32_t fldIdx, const SVFType* type, u32_t elemIdx)
 {
@@ -0,0 +1,342 @@
+//===- BDDExpr.cpp -- Binary decision diagram conditions--------------------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013->  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+/*
+ * BDDExpr.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: SVF team
+ */
+
+#include "Util/BDDExpr.h"
+#include <sstream>
+
+using namespace SVF;
+
+/// Initial number of live nodes before the first garbage collection
+static const u32_t initialGCThreshold = 1 << 18;
+/// Number of operation cache entries, a power of two
+static const u32_t opCacheSize = 1 << 18;
+/// Maximum number of paths printed by dumpStr
+static const u32_t maxDumpedPaths = 64;
+
+BDDManager::BDDManager() : gcThreshold(initialGCThreshold), numOfLiveNodes(0), peakLiveNodes(0),
+    numOfGCs(0), numOfCacheHits(0), numOfCacheLookups(0)
+{
+    /// the two terminals
+    nodes.push_back(Node{TerminalVar, FalseNode, FalseNode, 0});
+    nodes.push_back(Node{TerminalVar, TrueNode, TrueNode, 0});
+    opCache.resize(opCacheSize, CacheEntry{OpNone, 0, 0, 0});
+}
+
+BDDManager& BDDManager::getManager()
+{
+    /// never released, handles may outlive static destruction
+    static BDDManager* manager = new BDDManager();
+    return *manager;
+}
+
+BDDManager::NodeIndex BDDManager::mkNode(u32_t var, NodeIndex low, NodeIndex high)
+{
+    /// reduction: both cofactors are the same function
+    if (low == high)
+        return low;
+
+    NodeKey key{var, low, high};
+    UniqueTable::const_iterator it = uniqueTable.find(key);
+    if (it != uniqueTable.end())
+        return it->second;
+
+    NodeIndex n;
+    if (freeNodes.empty())
+    {
+        n = nodes.size();
+        nodes.push_back(Node{var, low, high, 0});
+    }
+    else
+    {
+        n = freeNodes.back();
+        freeNodes.pop_back();
+        nodes[n] = Node{var, low, high, 0};
+    }
+    uniqueTable.emplace(key, n);
+    numOfLiveNodes++;
+    if (numOfLiveNodes > peakLiveNodes)
+        peakLiveNodes = numOfLiveNodes;
+    return n;
+}
+
+BDDManager::NodeIndex BDDManager::mkVar(u32_t var)
+{
+    assert(var != TerminalVar && "invalid BDD variable");
+    collectIfNeeded();
+    return mkNode(var, FalseNode, TrueNode);
+}
+
+BDDManager::NodeIndex BDDManager::mkAnd(NodeIndex lhs, NodeIndex rhs)
+{
+    assert(lhs != NullNode && rhs != NullNode && "null BDD operand");
+    collectIfNeeded();
+    return apply(OpAnd, lhs, rhs);
+}
+
+BDDManager::NodeIndex BDDManager::mkOr(NodeIndex lhs, NodeIndex rhs)
+{
+    assert(lhs != NullNode && rhs != NullNode && "null BDD operand");
+    collectIfNeeded();
+    return apply(OpOr, lhs, rhs);
+}
+
+BDDManager::NodeIndex BDDManager::mkNeg(NodeIndex n)
+{
+    assert(n != NullNode && "null BDD operand");
+    collectIfNeeded();
+    return negate(n);
+}
+
+/*!
+ * Shannon expansion on the topmost variable of lhs and rhs.
+ * Nodes created here are not referenced by any handle until the top-level
+ * operation returns, which is why collection only happens before it starts.
+ */
+BDDManager::NodeIndex BDDManager::apply(Operator op, NodeIndex lhs, NodeIndex rhs)
+{
+    if (op == OpAnd)
+    {
+        if (lhs == FalseNode || rhs == FalseNode)
+            return FalseNode;
+        if (lhs == TrueNode || lhs == rhs)
+            return rhs;
+        if (rhs == TrueNode)
+            return lhs;
+    }
+    else
+    {
+        if (lhs == TrueNode || rhs == TrueNode)
+            return TrueNode;
+        if (lhs == FalseNode || lhs == rhs)
+            return rhs;
+        if (rhs == FalseNode)
+            return lhs;
+    }
+    /// both operators are commutative
+    if (lhs > rhs)
+        std::swap(lhs, rhs);
+
+    numOfCacheLookups++;
+    CacheEntry& entry = cacheSlot(op, lhs, rhs);
+    if (entry.op == (u32_t) op && entry.lhs == lhs && entry.rhs == rhs)
+    {
+        numOfCacheHits++;
+        return entry.res;
+    }
+
+    u32_t lvar = nodes[lhs].var;
+    u32_t rvar = nodes[rhs].var;
+    u32_t var = std::min(lvar, rvar);
+    NodeIndex l0 = lvar == var ? nodes[lhs].low : lhs;
+    NodeIndex l1 = lvar == var ? nodes[lhs].high : lhs;
+    NodeIndex r0 = rvar == var ? nodes[rhs].low : rhs;
+    NodeIndex r1 = rvar == var ? nodes[rhs].high : rhs;
+
+    NodeIndex low = apply(op, l0, r0);
+    NodeIndex high = apply(op, l1, r1);
+    NodeIndex res = mkNode(var, low, high);
+
+    /// the recursion may have reused the slot
+    CacheEntry& slot = cacheSlot(op, lhs, rhs);
+    slot = CacheEntry{(u32_t) op, lhs, rhs, res};
+    return res;
+}
+
+BDDManager::NodeIndex BDDManager::negate(NodeIndex n)
+{
+    if (n == FalseNode)
+        return TrueNode;
+    if (n == TrueNode)
+        return FalseNode;
+
+    numOfCacheLookups++;
+    CacheEntry& entry = cacheSlot(OpNeg, n, n);
+    if (entry.op == OpNeg && entry.lhs == n)
+    {
+        numOfCacheHits++;
+        return entry.res;
+    }
+
+    u32_t var = nodes[n].var;
+    NodeIndex low = negate(nodes[n].low);
+    NodeIndex high = negate(nodes[n].high);
+    NodeIndex res = mkNode(var, low, high);
+
+    CacheEntry& slot = cacheSlot(OpNeg, n, n);
+    slot = CacheEntry{OpNeg, n, n, res};
+    /// !!n == n
+    CacheEntry& inv = cacheSlot(OpNeg, res, res);
+    inv = CacheEntry{OpNeg, res, res, n};
+    return res;
+}
+
+void BDDManager::collectIfNeeded()
+{
+    if (numOfLiveNodes >= gcThreshold)
+        collect();
+}
+
+/*!
+ * Mark every node reachable from a node held by a handle, then put the
+ * others on the free list. The operation cache may refer to reclaimed nodes
+ * and is cleared. The threshold doubles when most nodes survive.
+ */
+void BDDManager::collect()
+{
+    numOfGCs++;
+    std::vector<bool> marked(nodes.size(), false);
+    marked[FalseNode] = marked[TrueNode] = true;
+    std::vector<NodeIndex> stack;
+    for (NodeIndex n = 2; n < nodes.size(); ++n)
+    {
+        if (nodes[n].refs > 0 && !marked[n])
+        {
+            marked[n] = true;
+            stack.push_back(n);
+        }
+    }
+    while (!stack.empty())
+    {
+        NodeIndex n = stack.back();
+        stack.pop_back();
+        for (NodeIndex child : {nodes[n].low, nodes[n].high})
+        {
+            if (!marked[child])
+            {
+                marked[child] = true;
+                stack.push_back(child);
+            }
+        }
+    }
+
+    for (NodeIndex n = 2; n < nodes.size(); ++n)
+    {
+        Node& node = nodes[n];
+        /// a reclaimed node has low == NullNode
+        if (marked[n] || node.low == NullNode)
+            continue;
+        uniqueTable.erase(NodeKey{node.var, node.low, node.high});
+        node = Node{TerminalVar, NullNode, NullNode, 0};
+        freeNodes.push_back(n);
+        numOfLiveNodes--;
+    }
+    std::fill(opCache.begin(), opCache.end(), CacheEntry{OpNone, 0, 0, 0});
+
+    if (numOfLiveNodes * 2 > gcThreshold)
+        gcThreshold *= 2;
+}
+
+void BDDExpr::getSatLiterals(Set<std::pair<u32_t, bool>>& literals) const
+{
+    const BDDManager& mgr = BDDManager::getManager();
+    if (isNull() || mgr.isTerminal(node))
+        return;
+    Set<NodeIndex> visited;
+    std::vector<NodeIndex> stack{node};
+    visited.insert(node);
+    while (!stack.empty())
+    {
+        NodeIndex n = stack.back();
+        stack.pop_back();
+        /// in a reduced BDD every non-false node has a path to true
+        if (mgr.getLow(n) != BDDManager::FalseNode)
+            literals.insert(std::make_pair(mgr.getVar(n), false));
+        if (mgr.getHigh(n) != BDDManager::FalseNode)
+            literals.insert(std::make_pair(mgr.getVar(n), true));
+        for (NodeIndex child : {mgr.getLow(n), mgr.getHigh(n)})
+        {
+            if (!mgr.isTerminal(child) && visited.insert(child).second)
+                stack.push_back(child);
+        }
+    }
+}
+
+u32_t BDDExpr::getExprSize(const BDDExpr& expr)
+{
+    const BDDManager& mgr = BDDManager::getManager();
+    if (expr.isNull())
+        return 0;
+    Set<NodeIndex> visited;
+    std::vector<NodeIndex> stack{expr.node};
+    visited.insert(expr.node);
+    while (!stack.empty())
+    {
+        NodeIndex n = stack.back();
+        stack.pop_back();
+        if (mgr.isTerminal(n))
+            continue;
+        for (NodeIndex child : {mgr.getLow(n), mgr.getHigh(n)})
+        {
+            if (visited.insert(child).second)
+                stack.push_back(child);
+        }
+    }
+    return visited.size();
+}
+
+/// Print the paths from n to true, at most maxDumpedPaths of them
+static void dumpPaths(BDDManager::NodeIndex n, std::vector<std::string>& cube, std::vector<std::string>& paths)
+{
+    const BDDManager& mgr = BDDManager::getManager();
+    if (paths.size() > maxDumpedPaths || n == BDDManager::FalseNode)
+        return;
+    if (n == BDDManager::TrueNode)
+    {
+        std::string path;
+        for (const std::string& lit : cube)
+            path += (path.empty() ? "" : " & ") + lit;
+        paths.push_back(cube.size() > 1 ? "(" + path + ")" : path);
+        return;
+    }
+    std::string var = "c" + std::to_string(mgr.getVar(n));
+    cube.push_back(var);
+    dumpPaths(mgr.getHigh(n), cube, paths);
+    cube.back() = "!" + var;
+    dumpPaths(mgr.getLow(n), cube, paths);
+    cube.pop_back();
+}
+
+std::string BDDExpr::dumpStr(const BDDExpr& expr)
+{
+    if (expr.isNull())
+        return "null";
+    if (expr.isTrue())
+        return "true";
+    if (expr.isFalse())
+        return "false";
+
+    std::vector<std::string> cube;
+    std::vector<std::string> paths;
+    dumpPaths(expr.node, cube, paths);
+    std::ostringstream out;
+    for (u32_t i = 0; i < paths.size() && i < maxDumpedPaths; ++i)
+        out << (i == 0 ? "" : " | ") << paths[i];
+    if (paths.size() > maxDumpedPaths)
+        out << " | ...";
+    return out.str();
+}
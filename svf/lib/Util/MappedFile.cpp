@@ -0,0 +1,110 @@
+//===- MappedFile.cpp -- Read-only memory-mapped files -------------------------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013->  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * MappedFile.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "Util/MappedFile.h"
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace SVF;
+
+/// An empty file cannot be mapped, so it is represented by this buffer
+static const char emptyFileBuffer[1] = {0};
+
+bool MappedFile::open(const std::string& fileName)
+{
+    close();
+
+    int fd = ::open(fileName.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    length = st.st_size;
+    if (length == 0)
+    {
+        buffer = emptyFileBuffer;
+        ::close(fd);
+        return true;
+    }
+
+    void* addr = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping stays valid after the descriptor is closed
+    ::close(fd);
+    if (addr == MAP_FAILED)
+    {
+        length = 0;
+        return false;
+    }
+    // The file is read front to back (possibly by several threads at once)
+    madvise(addr, length, MADV_SEQUENTIAL);
+    buffer = static_cast<const char*>(addr);
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (buffer != nullptr && buffer != emptyFileBuffer)
+        munmap(const_cast<char*>(buffer), length);
+    buffer = nullptr;
+    length = 0;
+}
+
+std::vector<std::pair<size_t, size_t>> MappedFile::splitLines(u32_t n) const
+{
+    std::vector<std::pair<size_t, size_t>> chunks;
+    if (n == 0)
+        n = 1;
+    size_t chunkSize = length / n + 1;
+    size_t begin = 0;
+    while (begin < length)
+    {
+        size_t end = begin + chunkSize;
+        if (end >= length)
+        {
+            end = length;
+        }
+        else
+        {
+            // Extend the chunk to the end of the line it stops in
+            const void* nl = memchr(buffer + end, '\n', length - end);
+            end = nl == nullptr ? length : static_cast<const char*>(nl) - buffer + 1;
+        }
+        chunks.push_back(std::make_pair(begin, end));
+        begin = end;
+    }
+    return chunks;
+}
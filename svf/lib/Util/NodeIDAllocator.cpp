@@ -4,6 +4,7 @@
 #include <iostream>
 #include <queue>
 #include <cmath>
+#include <algorithm>
 
 #include "FastCluster/fastcluster.h"
 #include "MemoryModel/PointerAnalysisImpl.h"
@@ -13,6 +14,8 @@
 #include "SVFIR/SVFType.h"
 #include "Util/SVFUtil.h"
 #include "Util/Options.h"
+#include "Util/SCC.h"
+#include "Graphs/ConsG.h"
 
 namespace SVF
 {
@@ -172,6 +175,7 @@ const std::string NodeIDAllocator::Clusterer::NumObjects = "NumObjects";
 const std::string NodeIDAllocator::Clusterer::RegioningTime = "RegioningTime";
 const std::string NodeIDAllocator::Clusterer::DistanceMatrixTime = "DistanceMatrixTime";
 const std::string NodeIDAllocator::Clusterer::FastClusterTime = "FastClusterTime";
+const std::string NodeIDAllocator::Clusterer::MinHashTime = "MinHashTime";
 const std::string NodeIDAllocator::Clusterer::DendrogramTraversalTime = "DendrogramTravTime";
 const std::string NodeIDAllocator::Clusterer::EvalTime = "EvalTime";
 const std::string NodeIDAllocator::Clusterer::TotalTime = "TotalTime";
@@ -193,6 +197,7 @@ std::vector<NodeID> NodeIDAllocator::Clusterer::cluster(BVDataPTAImpl *pta, cons
 
     Map<std::string, std::string> overallStats;
     double fastClusterTime = 0.0;
+    double minHashTime = 0.0;
     double distanceMatrixTime = 0.0;
     double dendrogramTraversalTime = 0.0;
     double regioningTime = 0.0;
@@ -351,6 +356,16 @@ std::vector<NodeID> NodeIDAllocator::Clusterer::cluster(BVDataPTAImpl *pta, cons
             ++numGtIntRegions;
             nonTrivialRegionObjects += regionNumObjects;
 
+            if (method == HCLUST_METHOD_SVF_MINHASH)
+            {
+                clkStart = PTAStat::getClk(true);
+                minHashOrder(nodeMap, regionsPointsTos[region], regionMappings[region],
+                             regionReverseMappings[region], allocCounter);
+                clkEnd = PTAStat::getClk(true);
+                minHashTime += (clkEnd - clkStart) / TIMEINTERVAL;
+                continue;
+            }
+
             double *distMatrix = getDistanceMatrix(regionsPointsTos[region], regionNumObjects,
                                                    regionReverseMappings[region], distanceMatrixTime);
 
@@ -387,8 +402,9 @@ std::vector<NodeID> NodeIDAllocator::Clusterer::cluster(BVDataPTAImpl *pta, cons
     overallStats[DistanceMatrixTime] = std::to_string(distanceMatrixTime);
     overallStats[DendrogramTraversalTime] = std::to_string(dendrogramTraversalTime);
     overallStats[FastClusterTime] = std::to_string(fastClusterTime);
+    overallStats[MinHashTime] = std::to_string(minHashTime);
     overallStats[EvalTime] = std::to_string(evalTime);
-    overallStats[TotalTime] = std::to_string(distanceMatrixTime + dendrogramTraversalTime + fastClusterTime + regioningTime + evalTime);
+    overallStats[TotalTime] = std::to_string(distanceMatrixTime + dendrogramTraversalTime + fastClusterTime + minHashTime + regioningTime + evalTime);
 
     overallStats[BestCandidate] = SVFUtil::hclustMethodToString(bestMapping.first);
     printStats(evalSubtitle + ": overall", overallStats);
@@ -531,6 +547,142 @@ void NodeIDAllocator::Clusterer::traverseDendrogram(std::vector<NodeID> &nodeMap
     }
 }
 
+/// Number of MinHash functions per object signature.
+static const unsigned minHashFunctions = 16;
+/// Upper bound on label propagation rounds; it usually settles in a handful.
+static const unsigned minHashRounds = 8;
+
+/// SplitMix64 finaliser, used to derive the MinHash functions.
+static inline u64_t mixHash(u64_t x)
+{
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+/// Returns the most frequent label in counts, the smallest one on ties.
+static inline u64_t majorityLabel(const Map<u64_t, unsigned> &counts)
+{
+    u64_t best = std::numeric_limits<u64_t>::max();
+    unsigned bestCount = 0;
+    for (const std::pair<const u64_t, unsigned> &lc : counts)
+    {
+        if (lc.second > bestCount || (lc.second == bestCount && lc.first < best))
+        {
+            best = lc.first;
+            bestCount = lc.second;
+        }
+    }
+
+    return best;
+}
+
+void NodeIDAllocator::Clusterer::minHashOrder(std::vector<NodeID> &nodeMap, const std::vector<std::pair<const PointsTo *, unsigned>> &pointsToSets,
+        const std::vector<NodeID> &regionMapping, const Map<NodeID, unsigned> &regionReverseMapping,
+        unsigned &allocCounter)
+{
+    const size_t numObjects = regionMapping.size();
+    const size_t numSets = pointsToSets.size();
+
+    // Occurrences of each object as a CSR list of points-to set indices.
+    std::vector<unsigned> occurrenceStart(numObjects + 1, 0);
+    for (const std::pair<const PointsTo *, unsigned> &ptsOcc : pointsToSets)
+    {
+        for (const NodeID o : *ptsOcc.first) ++occurrenceStart[regionReverseMapping.at(o) + 1];
+    }
+
+    for (size_t i = 0; i < numObjects; ++i) occurrenceStart[i + 1] += occurrenceStart[i];
+
+    std::vector<unsigned> occurrences(occurrenceStart[numObjects]);
+    std::vector<unsigned> fill(occurrenceStart.begin(), occurrenceStart.end() - 1);
+    // The object's index in the region, for every member of every points-to set.
+    std::vector<std::vector<unsigned>> members(numSets);
+    for (size_t s = 0; s < numSets; ++s)
+    {
+        for (const NodeID o : *pointsToSets[s].first)
+        {
+            const unsigned i = regionReverseMapping.at(o);
+            occurrences[fill[i]++] = s;
+            members[s].push_back(i);
+        }
+    }
+
+    // signatures[i * minHashFunctions + h] is the minimum of hash function h over the
+    // indices of the points-to sets object i occurs in. Two objects agree on a function
+    // with probability equal to the Jaccard similarity of their occurrence sets.
+    std::vector<u64_t> signatures(numObjects * minHashFunctions, std::numeric_limits<u64_t>::max());
+    for (size_t s = 0; s < numSets; ++s)
+    {
+        u64_t hashes[minHashFunctions];
+        for (unsigned h = 0; h < minHashFunctions; ++h) hashes[h] = mixHash(mixHash(s) + h);
+
+        for (const unsigned i : members[s])
+        {
+            u64_t *signature = &signatures[i * minHashFunctions];
+            for (unsigned h = 0; h < minHashFunctions; ++h)
+            {
+                if (hashes[h] < signature[h]) signature[h] = hashes[h];
+            }
+        }
+    }
+
+    // Seed every object's label with its first MinHash, so objects with similar
+    // occurrences start out together, then propagate labels over the bipartite
+    // object/points-to set graph: a set takes its members' majority label, and an
+    // object the majority label of the sets it occurs in (weighted by how often
+    // each set occurs). Each round is linear in the size of the points-to sets.
+    std::vector<u64_t> labels(numObjects);
+    for (size_t i = 0; i < numObjects; ++i) labels[i] = signatures[i * minHashFunctions];
+
+    std::vector<u64_t> setLabels(numSets);
+    Map<u64_t, unsigned> counts;
+    for (unsigned round = 0; round < minHashRounds; ++round)
+    {
+        for (size_t s = 0; s < numSets; ++s)
+        {
+            counts.clear();
+            for (const unsigned i : members[s]) ++counts[labels[i]];
+            setLabels[s] = majorityLabel(counts);
+        }
+
+        bool changed = false;
+        for (size_t i = 0; i < numObjects; ++i)
+        {
+            counts.clear();
+            for (unsigned k = occurrenceStart[i]; k < occurrenceStart[i + 1]; ++k)
+            {
+                counts[setLabels[occurrences[k]]] += pointsToSets[occurrences[k]].second;
+            }
+
+            const u64_t label = majorityLabel(counts);
+            if (label != labels[i])
+            {
+                labels[i] = label;
+                changed = true;
+            }
+        }
+
+        if (!changed) break;
+    }
+
+    // Objects sharing a label are allocated together; inside a label, objects whose
+    // signatures share leading minima end up next to each other.
+    std::vector<unsigned> order(numObjects);
+    for (unsigned i = 0; i < numObjects; ++i) order[i] = i;
+    std::sort(order.begin(), order.end(), [&](unsigned a, unsigned b)
+    {
+        if (labels[a] != labels[b]) return labels[a] < labels[b];
+        const u64_t *sa = &signatures[a * minHashFunctions];
+        const u64_t *sb = &signatures[b * minHashFunctions];
+        if (std::lexicographical_compare(sa, sa + minHashFunctions, sb, sb + minHashFunctions)) return true;
+        if (std::lexicographical_compare(sb, sb + minHashFunctions, sa, sa + minHashFunctions)) return false;
+        return a < b;
+    });
+
+    for (const unsigned i : order) nodeMap[regionMapping[i]] = allocCounter++;
+}
+
 std::vector<NodeID> NodeIDAllocator::Clusterer::regionObjects(const Map<NodeID, Set<NodeID>> &graph, size_t numObjects, size_t &numLabels)
 {
     unsigned label = UINT_MAX;
@@ -614,7 +766,7 @@ void NodeIDAllocator::Clusterer::evaluate(const std::vector<NodeID> &nodeMap, co
         // Check number of words for new SBV.
         words.clear();
         // TODO: nasty hardcoding.
-        for (const NodeID o : pts) words.insert(nodeMap[o] / 128);
+        for (const NodeID o : pts) words.insert((o < nodeMap.size() ? nodeMap[o] : o) / 128);
         u64_t newSbv = words.size() * 2;
         if (accountForOcc) newSbv *= occ;
 
@@ -623,7 +775,7 @@ void NodeIDAllocator::Clusterer::evaluate(const std::vector<NodeID> &nodeMap, co
         max = 0;
         for (const NodeID o : pts)
         {
-            const NodeID mappedO = nodeMap[o];
+            const NodeID mappedO = o < nodeMap.size() ? nodeMap[o] : o;
             if (mappedO < min) min = mappedO;
             if (mappedO > max) max = mappedO;
         }
@@ -697,7 +849,7 @@ void NodeIDAllocator::Clusterer::printStats(std::string subtitle, Map<std::strin
         NumObjects, TheoreticalNumWords, OriginalSbvNumWords, OriginalBvNumWords,
         NewSbvNumWords, NewBvNumWords, NumRegions, NumGtIntRegions,
         NumNonTrivialRegionObjects, LargestRegion, RegioningTime,
-        DistanceMatrixTime, FastClusterTime, DendrogramTraversalTime,
+        DistanceMatrixTime, FastClusterTime, MinHashTime, DendrogramTraversalTime,
         EvalTime, TotalTime, BestCandidate
     };
 
@@ -716,4 +868,153 @@ void NodeIDAllocator::Clusterer::printStats(std::string subtitle, Map<std::strin
     SVFUtil::outs().flush();
 }
 
+std::vector<NodeID> NodeIDAllocator::Reorderer::reorder(ConstraintGraph *consCG, Reordering ordering)
+{
+    assert(ordering != NO_REORDER && "Reorderer::reorder: no ordering requested");
+    SVFIR *pag = SVFIR::getPAG();
+
+    // Points-to sets only hold objects, so the mapping needs to cover IDs up to the largest object.
+    NodeID mapSize = 0;
+    for (SVFIR::iterator it = pag->begin(); it != pag->end(); ++it)
+    {
+        if (SVFUtil::isa<ObjVar>(it->second) && it->first >= mapSize) mapSize = it->first + 1;
+    }
+
+    std::vector<NodeID> order;
+    switch (ordering)
+    {
+    case RCM:
+        rcmOrder(consCG, order);
+        break;
+    case BFS:
+        bfsOrder(consCG, order);
+        break;
+    case SCC_TOPO:
+        sccOrder(consCG, order);
+        break;
+    default:
+        assert(false && "Reorderer::reorder: unknown ordering");
+    }
+
+    std::vector<NodeID> nodeMap(mapSize, UINT_MAX);
+    NodeID next = 0;
+    auto isObject = [pag](NodeID n)
+    {
+        return pag->hasGNode(n) && SVFUtil::isa<ObjVar>(pag->getGNode(n));
+    };
+    auto assign = [&nodeMap, &next, mapSize](NodeID n)
+    {
+        if (n < mapSize && nodeMap[n] == UINT_MAX) nodeMap[n] = next++;
+    };
+
+    // An object is placed either where its own node is visited or where
+    // the first pointer taking its address is, whichever comes first.
+    for (NodeID n : order)
+    {
+        if (isObject(n)) assign(n);
+        for (const ConstraintEdge *addr : consCG->getConstraintNode(n)->getAddrInEdges())
+        {
+            if (isObject(addr->getSrcID())) assign(addr->getSrcID());
+        }
+    }
+
+    // Objects not in the constraint graph, then the values sharing the ID range.
+    for (NodeID n = 0; n < mapSize; ++n)
+    {
+        if (isObject(n)) assign(n);
+    }
+    for (NodeID n = 0; n < mapSize; ++n) assign(n);
+
+    return nodeMap;
+}
+
+void NodeIDAllocator::Reorderer::bfsOrder(ConstraintGraph *consCG, std::vector<NodeID> &order)
+{
+    Set<NodeID> visited;
+    for (ConstraintGraph::iterator it = consCG->begin(); it != consCG->end(); ++it)
+    {
+        if (!visited.insert(it->first).second) continue;
+
+        FIFOWorkList<NodeID> worklist;
+        worklist.push(it->first);
+        while (!worklist.empty())
+        {
+            const NodeID n = worklist.pop();
+            order.push_back(n);
+            const ConstraintNode *node = consCG->getConstraintNode(n);
+            for (const ConstraintEdge *edge : node->getOutEdges())
+            {
+                if (visited.insert(edge->getDstID()).second) worklist.push(edge->getDstID());
+            }
+            for (const ConstraintEdge *edge : node->getInEdges())
+            {
+                if (visited.insert(edge->getSrcID()).second) worklist.push(edge->getSrcID());
+            }
+        }
+    }
+}
+
+void NodeIDAllocator::Reorderer::rcmOrder(ConstraintGraph *consCG, std::vector<NodeID> &order)
+{
+    Map<NodeID, size_t> degree;
+    std::vector<NodeID> nodes;
+    for (ConstraintGraph::iterator it = consCG->begin(); it != consCG->end(); ++it)
+    {
+        degree[it->first] = it->second->getOutEdges().size() + it->second->getInEdges().size();
+        nodes.push_back(it->first);
+    }
+
+    auto byDegree = [&degree](NodeID a, NodeID b)
+    {
+        return std::make_pair(degree[a], a) < std::make_pair(degree[b], b);
+    };
+
+    // Cuthill-McKee: start each component at a minimum-degree node and visit
+    // neighbours by increasing degree.
+    std::stable_sort(nodes.begin(), nodes.end(), byDegree);
+    std::vector<NodeID> cmOrder;
+    Set<NodeID> visited;
+    for (NodeID seed : nodes)
+    {
+        if (!visited.insert(seed).second) continue;
+
+        FIFOWorkList<NodeID> worklist;
+        worklist.push(seed);
+        while (!worklist.empty())
+        {
+            const NodeID n = worklist.pop();
+            cmOrder.push_back(n);
+            const ConstraintNode *node = consCG->getConstraintNode(n);
+            std::vector<NodeID> neighbours;
+            for (const ConstraintEdge *edge : node->getOutEdges())
+            {
+                if (visited.insert(edge->getDstID()).second) neighbours.push_back(edge->getDstID());
+            }
+            for (const ConstraintEdge *edge : node->getInEdges())
+            {
+                if (visited.insert(edge->getSrcID()).second) neighbours.push_back(edge->getSrcID());
+            }
+            std::sort(neighbours.begin(), neighbours.end(), byDegree);
+            for (NodeID neighbour : neighbours) worklist.push(neighbour);
+        }
+    }
+
+    order.insert(order.end(), cmOrder.rbegin(), cmOrder.rend());
+}
+
+void NodeIDAllocator::Reorderer::sccOrder(ConstraintGraph *consCG, std::vector<NodeID> &order)
+{
+    SCCDetection<ConstraintGraph *> scc(consCG);
+    scc.find();
+
+    // Copy, as the stack is consumed.
+    SCCDetection<ConstraintGraph *>::GNodeStack topoOrder = scc.topoNodeStack();
+    while (!topoOrder.empty())
+    {
+        const NodeID rep = topoOrder.top();
+        topoOrder.pop();
+        for (const NodeID n : scc.subNodes(rep)) order.push_back(n);
+    }
+}
+
 };  // namespace SVF.
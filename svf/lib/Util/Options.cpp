@@ -46,15 +46,46 @@ const OptionMap<BVDataPTAImpl::PTBackingType> Options::ptDataBacking(
 {
     {BVDataPTAImpl::PTBackingType::Mutable, "mutable", "points-to set per pointer"},
     {BVDataPTAImpl::PTBackingType::Persistent, "persistent", "points-to set ID per pointer, operations hash-consed"},
+    {BVDataPTAImpl::PTBackingType::Spilled, "spilled", "as mutable, flow-sensitive IN/OUT sets beyond -ptd-budget moved to a spill file"},
 }
 );
 
+const Option<u32_t> Options::PtdBudget(
+    "ptd-budget",
+    "Memory budget (MB) for the flow-sensitive IN/OUT points-to sets with -ptd=spilled",
+    4096
+);
+
+const Option<std::string> Options::PtdSpillFile(
+    "ptd-spill-file",
+    "Spill file for -ptd=spilled (default: an anonymous file in $TMPDIR)",
+    ""
+);
+
+const Option<bool> Options::FreezePts(
+    "freeze-pts",
+    "Once solved, hash-cons the points-to sets into read-only storage and release the solving data",
+    true
+);
+
 const Option<u32_t> Options::FsTimeLimit(
     "fs-time-limit",
     "time limit for main phase of flow-sensitive analyses",
     0
 );
 
+const Option<bool> Options::FsAnytime(
+    "fs-anytime",
+    "when the time or memory limit of flow-sensitive analyses is reached, keep the refined results and use Andersen's for the rest",
+    false
+);
+
+const Option<u32_t> Options::FsMemLimit(
+    "fs-mem-limit",
+    "memory limit (MB) for main phase of anytime flow-sensitive analyses",
+    0
+);
+
 const Option<u32_t> Options::VersioningThreads(
     "versioning-threads",
     "number of threads to use in the versioning phase of versioned flow-sensitive analysis",
@@ -244,6 +275,12 @@ const Option<std::string> Options::SelfCycle(
     ""
 );
 
+const Option<u32_t> Options::MaxBypassGrowth(
+    "max-bypass-growth",
+    "Keep an MSSA phi if bypassing it adds more than this many edges beyond the ones it removes (0: no limit)",
+    100
+);
+
 
 // Sparse value-flow graph (VFG.cpp)
 const Option<bool> Options::DumpVFG(
@@ -252,6 +289,12 @@ const Option<bool> Options::DumpVFG(
     false
 );
 
+const Option<u32_t> Options::VFGBuildThreads(
+    "vfg-build-threads",
+    "number of threads collecting the intra-procedural edges of VFG/SVFG",
+    1
+);
+
 
 // Location set for modeling abstract memory object (LocationSet.cpp)
 const Option<bool> Options::SingleStride(
@@ -322,6 +365,30 @@ const Option<bool> Options::CallGraphDotGraph(
     false
 );
 
+const OptionMap<GraphFormat::Name> Options::DumpGraphFormat(
+    "graph-format",
+    "File format of dumped graphs (-dump-pag, -dump-icfg, -dump-vfg, -dump-callgraph, ...)",
+    GraphFormat::DOT,
+{
+    {GraphFormat::DOT, "dot", "Graphviz dot file"},
+    {GraphFormat::BINARY, "binary", "compact binary edge list (.bin)"},
+    {GraphFormat::GRAPHML, "graphml", "GraphML file (.graphml)"},
+    {GraphFormat::CSV, "csv", "node and edge tables (.nodes.csv, .edges.csv)"},
+}
+);
+
+const Option<std::string> Options::DumpGraphColumns(
+    "graph-columns",
+    "Comma-separated columns exported besides IDs for non-dot graph formats: kind, label, attrs",
+    "kind"
+);
+
+const Option<u32_t> Options::DumpGraphThreads(
+    "graph-export-threads",
+    "number of threads rendering node ranges when exporting graphs in non-dot formats",
+    1
+);
+
 const Option<bool> Options::PAGPrint(
     "print-pag",
     "Print SVFIR to command line",
@@ -358,6 +425,12 @@ const Option<bool> Options::ConnectVCallOnCHA(
     false
 );
 
+const Option<bool> Options::IncrementalCallGraph(
+    "incremental-cg",
+    "Only resolve the newly pointed-to targets of indirect callsites and limit wave SCC detection to nodes affected by new edges",
+    true
+);
+
 
 // PointerAnalysisImpl.cpp
 const Option<bool> Options::INCDFPTData(
@@ -384,6 +457,18 @@ const Option<bool> Options::PlainMappingFs(
     false
 );
 
+const OptionMap<NodeIDAllocator::Reordering> Options::NodeReorder(
+    "node-reorder",
+    "Renumber objects inside points-to sets of Andersen's and FS/VFS by a constraint graph locality ordering",
+    NodeIDAllocator::Reordering::NO_REORDER,
+{
+    {NodeIDAllocator::Reordering::NO_REORDER, "none", "keep the allocation order (default)"},
+    {NodeIDAllocator::Reordering::RCM, "rcm", "reverse Cuthill-McKee ordering"},
+    {NodeIDAllocator::Reordering::BFS, "bfs", "breadth-first ordering from the first allocated nodes"},
+    {NodeIDAllocator::Reordering::SCC_TOPO, "scc", "topological ordering of strongly connected components"},
+}
+);
+
 const OptionMap<PointsTo::Type> Options::PtType(
     "pt-type",
     "points-to set data structure to use in all analyses",
@@ -404,6 +489,7 @@ const OptionMap<enum hclust_fast_methods> Options::ClusterMethod(
     {HCLUST_METHOD_COMPLETE, "complete", "complete linkage; nearest-neighbour-chain algorithm"},
     {HCLUST_METHOD_AVERAGE,   "average", "unweighted average linkage; nearest-neighbour-chain algorithm"},
     {HCLUST_METHOD_SVF_BEST,     "best", "try all linkage criteria; choose best"},
+    {HCLUST_METHOD_SVF_MINHASH, "minhash", "order by MinHash/LSH sketches of co-occurrence; near-linear, for large programs"},
 }
 );
 
@@ -531,6 +617,12 @@ const Option<bool> Options::DoLockAnalysis(
     true
 );
 
+const Option<u32_t> Options::MHPThreads(
+    "mhp-threads",
+    "number of threads used to build the per-instruction MHP query index",
+    1
+);
+
 
 // MTA.cpp
 const Option<bool> Options::AndersenAnno(
@@ -678,6 +770,12 @@ const Option<bool> Options::PrintPathCond(
     false
 );
 
+const Option<bool> Options::SaberBDD(
+    "saber-bdd",
+    "Represent path conditions as BDDs instead of Z3 expressions",
+    false
+);
+
 
 // SVFUtil.cpp
 const Option<bool> Options::DisableWarn(
@@ -737,6 +835,18 @@ const Option<bool> Options::VtableInSVFIR(
     false
 );
 
+const Option<bool> Options::LazySVFIR(
+    "lazy-svfir",
+    "Build ICFG nodes and SVFIR statements of a function only when an analysis first needs it",
+    false
+);
+
+const Option<bool> Options::HVN(
+    "hvn",
+    "Merge pointer-equivalent constraint nodes by offline hash-based value numbering before Andersen's analysis",
+    false
+);
+
 
 //WPAPass.cpp
 const Option<bool> Options::AnderSVFG(
@@ -763,6 +873,8 @@ OptionMultiple<PointerAnalysis::PTATY> Options::PASelected(
     {PointerAnalysis::Andersen_WPA, "nander", "Standard inclusion-based analysis"},
     {PointerAnalysis::AndersenSCD_WPA, "sander", "Selective cycle detection inclusion-based analysis"},
     {PointerAnalysis::AndersenSFR_WPA, "sfrander", "Stride-based field representation includion-based analysis"},
+    {PointerAnalysis::AndersenLCD_WPA, "lcdander", "Lazy cycle detection inclusion-based analysis"},
+    {PointerAnalysis::AndersenHCD_WPA, "hcdander", "Hybrid cycle detection inclusion-based analysis"},
     {PointerAnalysis::AndersenWaveDiff_WPA, "ander", "Diff wave propagation inclusion-based analysis"},
     {PointerAnalysis::Steensgaard_WPA, "steens", "Steensgaard's pointer analysis"},
     // Disabled till further work is done.
@@ -781,6 +893,19 @@ OptionMultiple<WPAPass::AliasCheckRule> Options::AliasRule(
 }
 );
 
+// AnalysisServer.cpp
+const Option<std::string> Options::ServerSocket(
+    "server-socket",
+    "After the analysis, keep its results resident and answer line-delimited JSON queries on this Unix-domain socket (wpa; add -svfg for value-flow queries)",
+    ""
+);
+
+const Option<u32_t> Options::ServerThreads(
+    "server-threads",
+    "number of threads serving connections of the analysis server",
+    4
+);
+
 const Option<bool> Options::ShowHiddenNode(
     "show-hidden-nodes",
     "Show hidden nodes on DOT Graphs (e.g., isolated node on a graph)",
@@ -829,6 +954,18 @@ const Option<bool> Options::POCRAlias(
     false
 );
 
+const Option<u32_t> Options::CFLSolverThreads(
+    "cfl-threads",
+    "number of threads to use in CFL graph loading and the CFL-reachability solver (1 for the serial worklist solver)",
+    1
+);
+
+const Option<std::string> Options::WriteCFLGraph(
+    "write-cflgraph",
+    "Write the built CFL graph to the given file as a binary edge list, which can be loaded again with -cflgraph",
+    ""
+);
+
 const Option<bool> Options::LoopAnalysis(
     "loop-analysis",
     "Analyze every func and get loop info and loop bounds.",
@@ -841,4 +978,16 @@ const Option<u32_t> Options::LoopBound(
     1
 );
 
+const Option<u32_t> Options::AEWidenDelay(
+    "ae-widen-delay",
+    "Number of plain join iterations at a cycle head before widening in abstract execution",
+    3
+);
+
+const Option<u32_t> Options::AENarrowingIters(
+    "ae-narrow-iters",
+    "Maximum number of narrowing iterations at a cycle head in abstract execution",
+    2
+);
+
 } // namespace SVF.
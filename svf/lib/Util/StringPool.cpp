@@ -0,0 +1,36 @@
+//===- StringPool.cpp -- Interned strings shared by SVF values ----------------//
+
+#include "Util/StringPool.h"
+
+namespace SVF
+{
+
+/// The pool is a function-local static so that it is constructed on first use,
+/// independent of the initialization order of other statics
+std::unordered_set<std::string>& StringPool::getPool()
+{
+    static std::unordered_set<std::string> pool;
+    return pool;
+}
+
+std::mutex& StringPool::getMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+/// Elements of an unordered_set are never relocated, so the returned reference
+/// survives later insertions
+const std::string& StringPool::intern(const std::string& str)
+{
+    std::lock_guard<std::mutex> lock(getMutex());
+    return *getPool().insert(str).first;
+}
+
+size_t StringPool::size()
+{
+    std::lock_guard<std::mutex> lock(getMutex());
+    return getPool().size();
+}
+
+} // End namespace SVF
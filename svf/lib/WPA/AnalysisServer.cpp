@@ -0,0 +1,450 @@
+//===- AnalysisServer.cpp -- Resident query server for pointer analysis results//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013-2017>  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * AnalysisServer.cpp
+ */
+
+#include "WPA/AnalysisServer.h"
+#include "Graphs/SVFG.h"
+#include "Util/cJSON.h"
+#include "Util/WorkList.h"
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <iomanip>
+#include <thread>
+
+using namespace SVF;
+using namespace SVFUtil;
+
+AnalysisServer::AnalysisServer(BVDataPTAImpl* p, SVFG* g)
+    : pta(p), pag(p->getPAG()), svfg(g), serialise(!p->isPointsToFrozen()), listenFd(-1),
+      stopping(false), numRequests(0), numErrors(0), totalLatencyNs(0), maxLatencyNs(0)
+{
+    startTime = std::chrono::steady_clock::now();
+}
+
+/*!
+ * Alias queries read the fields of objects through SVFIR::getAllFieldsObjVars,
+ * which inserts a map entry on first use. Touch every object once up front so
+ * that concurrent queries only read.
+ */
+void AnalysisServer::prepareForQueries()
+{
+    for (SVFIR::iterator it = pag->begin(), eit = pag->end(); it != eit; ++it)
+    {
+        if (isa<ObjVar>(it->second))
+            pag->getAllFieldsObjVars(it->first);
+    }
+}
+
+bool AnalysisServer::serve(const std::string& socketPath, u32_t numThreads)
+{
+    sockaddr_un addr;
+    if (socketPath.size() >= sizeof(addr.sun_path))
+    {
+        errs() << errMsg("socket path too long: ") << socketPath << "\n";
+        return false;
+    }
+
+    listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0)
+    {
+        errs() << errMsg("cannot create socket: ") << strerror(errno) << "\n";
+        return false;
+    }
+
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, socketPath.c_str(), sizeof(addr.sun_path) - 1);
+    unlink(socketPath.c_str());
+    if (bind(listenFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 || listen(listenFd, SOMAXCONN) < 0)
+    {
+        errs() << errMsg("cannot listen on ") << socketPath << ": " << strerror(errno) << "\n";
+        close(listenFd);
+        return false;
+    }
+
+    prepareForQueries();
+    startTime = std::chrono::steady_clock::now();
+    outs() << "Serving " << pta->PTAName() << " results on " << socketPath << " with "
+           << numThreads << " worker thread(s)\n";
+
+    std::vector<std::thread> workers;
+    for (u32_t i = 0; i < std::max(numThreads, 1u); ++i)
+        workers.push_back(std::thread(&AnalysisServer::workerLoop, this));
+
+    while (!stopping)
+    {
+        int fd = accept(listenFd, nullptr, nullptr);
+        if (fd < 0)
+        {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            // The listening socket was shut down by a shutdown request.
+            break;
+        }
+
+        std::lock_guard<std::mutex> lock(connMutex);
+        pendingConns.push_back(fd);
+        connCond.notify_one();
+    }
+
+    requestShutdown();
+    for (std::thread& t : workers)
+        t.join();
+
+    close(listenFd);
+    unlink(socketPath.c_str());
+    printStat();
+    return true;
+}
+
+/*!
+ * Stop accepting connections and wake up every worker and every blocked read.
+ * Only the read side of open connections is shut down, so responses still
+ * being written (e.g. to the shutdown request itself) are delivered.
+ */
+void AnalysisServer::requestShutdown()
+{
+    stopping = true;
+    shutdown(listenFd, SHUT_RDWR);
+
+    std::lock_guard<std::mutex> lock(connMutex);
+    for (int fd : activeConns)
+        shutdown(fd, SHUT_RD);
+    connCond.notify_all();
+}
+
+void AnalysisServer::workerLoop()
+{
+    while (true)
+    {
+        int fd;
+        {
+            std::unique_lock<std::mutex> lock(connMutex);
+            connCond.wait(lock, [this]()
+            {
+                return stopping || !pendingConns.empty();
+            });
+            if (pendingConns.empty())
+                return;
+
+            fd = pendingConns.front();
+            pendingConns.pop_front();
+            if (stopping)
+            {
+                close(fd);
+                continue;
+            }
+            activeConns.insert(fd);
+        }
+
+        serveConnection(fd);
+
+        {
+            std::lock_guard<std::mutex> lock(connMutex);
+            activeConns.erase(fd);
+        }
+        close(fd);
+    }
+}
+
+/*!
+ * Answer every request line on fd, in order, until the client closes the connection.
+ */
+void AnalysisServer::serveConnection(int fd)
+{
+    std::string buffer;
+    char chunk[4096];
+    while (true)
+    {
+        ssize_t received = recv(fd, chunk, sizeof(chunk), 0);
+        if (received < 0 && errno == EINTR) continue;
+        if (received <= 0) return;
+        buffer.append(chunk, received);
+
+        std::string::size_type begin = 0, end;
+        while ((end = buffer.find('\n', begin)) != std::string::npos)
+        {
+            std::string line = buffer.substr(begin, end - begin);
+            begin = end + 1;
+            if (line.empty() || line == "\r") continue;
+
+            std::string response = handleRequest(line) + "\n";
+            for (size_t sent = 0; sent < response.size();)
+            {
+                ssize_t n = send(fd, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+                if (n < 0 && errno == EINTR) continue;
+                if (n <= 0) return;
+                sent += n;
+            }
+        }
+        buffer.erase(0, begin);
+    }
+}
+
+std::string AnalysisServer::handleRequest(const std::string& line)
+{
+    const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+    cJSON* response = cJSON_CreateObject();
+    cJSON* request = cJSON_Parse(line.c_str());
+    std::string error;
+    if (request == nullptr || !cJSON_IsObject(request))
+    {
+        error = "malformed request";
+    }
+    else
+    {
+        cJSON* id = cJSON_GetObjectItem(request, "id");
+        if (id != nullptr)
+            cJSON_AddItemToObject(response, "id", cJSON_Duplicate(id, true));
+
+        if (serialise)
+        {
+            std::lock_guard<std::mutex> lock(queryMutex);
+            error = answer(request, response);
+        }
+        else
+        {
+            error = answer(request, response);
+        }
+    }
+
+    if (!error.empty())
+        cJSON_AddStringToObject(response, "error", error.c_str());
+
+    char* printed = cJSON_PrintUnformatted(response);
+    std::string result(printed);
+    cJSON_free(printed);
+    cJSON_Delete(response);
+    cJSON_Delete(request);
+
+    const auto latency = std::chrono::steady_clock::now() - begin;
+    recordLatency(std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count(), !error.empty());
+    return result;
+}
+
+std::string AnalysisServer::answer(const cJSON* request, cJSON* response)
+{
+    const cJSON* query = cJSON_GetObjectItem(request, "query");
+    if (query == nullptr || !cJSON_IsString(query))
+        return "missing \"query\"";
+
+    const std::string kind = query->valuestring;
+    if (kind == "pts")
+        return answerPts(request, response);
+    else if (kind == "alias")
+        return answerAlias(request, response);
+    else if (kind == "callees")
+        return answerCallees(request, response);
+    else if (kind == "callers")
+        return answerCallers(request, response);
+    else if (kind == "reach")
+        return answerReach(request, response);
+    else if (kind == "stats")
+    {
+        answerStats(response);
+        return "";
+    }
+    else if (kind == "shutdown")
+    {
+        std::lock_guard<std::mutex> lock(connMutex);
+        stopping = true;
+        shutdown(listenFd, SHUT_RDWR);
+        return "";
+    }
+
+    return "unknown query \"" + kind + "\"";
+}
+
+bool AnalysisServer::getIdField(const cJSON* request, const char* field, NodeID& id)
+{
+    const cJSON* item = cJSON_GetObjectItem(request, field);
+    if (item == nullptr || !cJSON_IsNumber(item) || item->valuedouble < 0)
+        return false;
+
+    id = static_cast<NodeID>(item->valuedouble);
+    return true;
+}
+
+std::string AnalysisServer::answerPts(const cJSON* request, cJSON* response)
+{
+    NodeID var;
+    if (!getIdField(request, "var", var) || !pag->hasGNode(var))
+        return "\"var\" must be an SVFIR node ID";
+
+    cJSON* pts = cJSON_CreateArray();
+    for (const NodeID o : pta->getPts(var))
+        cJSON_AddItemToArray(pts, cJSON_CreateNumber(o));
+    cJSON_AddItemToObject(response, "pts", pts);
+    return "";
+}
+
+std::string AnalysisServer::answerAlias(const cJSON* request, cJSON* response)
+{
+    NodeID var1, var2;
+    if (!getIdField(request, "var1", var1) || !pag->hasGNode(var1) ||
+            !getIdField(request, "var2", var2) || !pag->hasGNode(var2))
+        return "\"var1\" and \"var2\" must be SVFIR node IDs";
+
+    AliasResult result = pta->alias(var1, var2);
+    cJSON_AddStringToObject(response, "alias", result == AliasResult::NoAlias ? "NoAlias" : "MayAlias");
+    return "";
+}
+
+std::string AnalysisServer::answerCallees(const cJSON* request, cJSON* response)
+{
+    PTACallGraph* callgraph = pta->getPTACallGraph();
+    cJSON* callees = cJSON_CreateArray();
+    cJSON_AddItemToObject(response, "callees", callees);
+
+    NodeID callsite;
+    if (getIdField(request, "callsite", callsite))
+    {
+        ICFG* icfg = pag->getICFG();
+        const CallICFGNode* cs = icfg->hasGNode(callsite) ? dyn_cast<CallICFGNode>(icfg->getICFGNode(callsite)) : nullptr;
+        if (cs == nullptr)
+            return "\"callsite\" must be a call ICFG node ID";
+
+        PTACallGraph::FunctionSet functions;
+        callgraph->getCallees(cs, functions);
+        for (const SVFFunction* fun : functions)
+            cJSON_AddItemToArray(callees, cJSON_CreateString(fun->getName().c_str()));
+        return "";
+    }
+
+    const cJSON* name = cJSON_GetObjectItem(request, "function");
+    const SVFFunction* fun = (name != nullptr && cJSON_IsString(name)) ? pta->getModule()->getSVFFunction(name->valuestring) : nullptr;
+    if (fun == nullptr)
+        return "\"function\" must name a function, or \"callsite\" a call ICFG node ID";
+
+    Set<const SVFFunction*> seen;
+    for (const PTACallGraphEdge* edge : callgraph->getCallGraphNode(fun)->getOutEdges())
+    {
+        const SVFFunction* callee = edge->getDstNode()->getFunction();
+        if (seen.insert(callee).second)
+            cJSON_AddItemToArray(callees, cJSON_CreateString(callee->getName().c_str()));
+    }
+    return "";
+}
+
+std::string AnalysisServer::answerCallers(const cJSON* request, cJSON* response)
+{
+    const cJSON* name = cJSON_GetObjectItem(request, "function");
+    const SVFFunction* fun = (name != nullptr && cJSON_IsString(name)) ? pta->getModule()->getSVFFunction(name->valuestring) : nullptr;
+    if (fun == nullptr)
+        return "\"function\" must name a function";
+
+    cJSON* callers = cJSON_CreateArray();
+    cJSON_AddItemToObject(response, "callers", callers);
+    PTACallGraph* callgraph = pta->getPTACallGraph();
+    Set<const SVFFunction*> seen;
+    for (const PTACallGraphEdge* edge : callgraph->getCallGraphNode(fun)->getInEdges())
+    {
+        const SVFFunction* caller = edge->getSrcNode()->getFunction();
+        if (seen.insert(caller).second)
+            cJSON_AddItemToArray(callers, cJSON_CreateString(caller->getName().c_str()));
+    }
+    return "";
+}
+
+/*!
+ * Whether dst is reachable from src along SVFG (value-flow) edges.
+ */
+std::string AnalysisServer::answerReach(const cJSON* request, cJSON* response)
+{
+    if (svfg == nullptr)
+        return "no SVFG is resident (run with -svfg)";
+
+    NodeID src, dst;
+    if (!getIdField(request, "src", src) || !svfg->hasSVFGNode(src) ||
+            !getIdField(request, "dst", dst) || !svfg->hasSVFGNode(dst))
+        return "\"src\" and \"dst\" must be SVFG node IDs";
+
+    NodeBS visited;
+    FIFOWorkList<NodeID> worklist;
+    visited.set(src);
+    worklist.push(src);
+    bool reachable = false;
+    while (!worklist.empty() && !reachable)
+    {
+        const SVFGNode* node = svfg->getSVFGNode(worklist.pop());
+        for (const SVFGEdge* edge : node->getOutEdges())
+        {
+            const NodeID next = edge->getDstID();
+            if (next == dst)
+            {
+                reachable = true;
+                break;
+            }
+            if (visited.test_and_set(next))
+                worklist.push(next);
+        }
+    }
+
+    cJSON_AddBoolToObject(response, "reachable", reachable || src == dst);
+    return "";
+}
+
+void AnalysisServer::answerStats(cJSON* response) const
+{
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    const u64_t requests = numRequests.load();
+    cJSON_AddNumberToObject(response, "requests", requests);
+    cJSON_AddNumberToObject(response, "errors", numErrors.load());
+    cJSON_AddNumberToObject(response, "meanLatencyUs", requests == 0 ? 0 : totalLatencyNs.load() / 1000.0 / requests);
+    cJSON_AddNumberToObject(response, "maxLatencyUs", maxLatencyNs.load() / 1000.0);
+    cJSON_AddNumberToObject(response, "uptimeSec", elapsed);
+    cJSON_AddNumberToObject(response, "throughputPerSec", elapsed > 0 ? requests / elapsed : 0);
+}
+
+void AnalysisServer::recordLatency(u64_t latencyNs, bool failed)
+{
+    ++numRequests;
+    if (failed) ++numErrors;
+    totalLatencyNs += latencyNs;
+
+    u64_t max = maxLatencyNs;
+    while (latencyNs > max && !maxLatencyNs.compare_exchange_weak(max, latencyNs));
+}
+
+void AnalysisServer::printStat() const
+{
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    const u64_t requests = numRequests.load();
+
+    outs() << "\n****Analysis Server Statistics****\n";
+    outs() << "################ (program : " << pta->getModule()->getModuleIdentifier() << ")###############\n";
+    outs().flags(std::ios::left);
+    unsigned field_width = 20;
+    outs() << std::setw(field_width) << "Requests" << requests << "\n";
+    outs() << std::setw(field_width) << "Errors" << numErrors.load() << "\n";
+    outs() << std::setw(field_width) << "MeanLatencyUs" << (requests == 0 ? 0 : totalLatencyNs.load() / 1000.0 / requests) << "\n";
+    outs() << std::setw(field_width) << "MaxLatencyUs" << maxLatencyNs.load() / 1000.0 << "\n";
+    outs() << std::setw(field_width) << "UptimeSec" << elapsed << "\n";
+    outs() << std::setw(field_width) << "ThroughputPerSec" << (elapsed > 0 ? requests / elapsed : 0) << "\n";
+    outs() << "#######################################################" << std::endl;
+}
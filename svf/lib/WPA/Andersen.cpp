@@ -57,6 +57,10 @@ u32_t AndersenBase::MaxPointsToSetSize = 0;
 double AndersenBase::timeOfProcessCopyGep = 0;
 double AndersenBase::timeOfProcessLoadStore = 0;
 double AndersenBase::timeOfUpdateCallGraph = 0;
+u32_t AndersenBase::numOfHCDMerges = 0;
+u32_t AndersenBase::numOfHVNMergedNodes = 0;
+u32_t AndersenBase::numOfHVNRemovedEdges = 0;
+double AndersenBase::timeOfHVN = 0;
 
 /*!
  * Destructor
@@ -95,6 +99,9 @@ void AndersenBase::finalize()
     if (Options::PrintCGGraph())
         consCG->print();
     BVDataPTAImpl::finalize();
+
+    if (Options::FreezePts())
+        freezePointsTo();
 }
 
 /*!
@@ -197,9 +204,14 @@ void Andersen::initialize()
     AndersenBase::initialize();
 
     if (Options::ClusterAnder()) cluster();
+    else if (Options::NodeReorder() != NodeIDAllocator::Reordering::NO_REORDER) reorder();
 
     /// Initialize worklist
     processAllAddr();
+
+    /// Results read from a file are written to the original nodes
+    if (Options::HVN() && Options::ReadAnder().empty())
+        mergeOfflineEquivalentNodes();
 }
 
 /*!
@@ -209,7 +221,7 @@ void Andersen::finalize()
 {
     // TODO: check -stat too.
     // TODO: broken
-    if (Options::ClusterAnder())
+    if (Options::ClusterAnder() || Options::NodeReorder() != NodeIDAllocator::Reordering::NO_REORDER)
     {
         Map<std::string, std::string> stats;
         const PTDataTy *ptd = getPTDataTy();
@@ -251,19 +263,10 @@ void Andersen::processNode(NodeID nodeId)
  */
 void Andersen::handleCopyGep(ConstraintNode* node)
 {
-    NodeID nodeId = node->getId();
-    computeDiffPts(nodeId);
-
-    if (!getDiffPts(nodeId).empty())
+    propagateDiffPts(node, [this](NodeID nodeId, const ConstraintEdge* copy)
     {
-        for (ConstraintEdge* edge : node->getCopyOutEdges())
-            processCopy(nodeId, edge);
-        for (ConstraintEdge* edge : node->getGepOutEdges())
-        {
-            if (GepCGEdge* gepEdge = SVFUtil::dyn_cast<GepCGEdge>(edge))
-                processGep(nodeId, gepEdge);
-        }
-    }
+        Andersen::processCopy(nodeId, copy);
+    });
 }
 
 /*!
@@ -272,24 +275,24 @@ void Andersen::handleCopyGep(ConstraintNode* node)
 void Andersen::handleLoadStore(ConstraintNode *node)
 {
     NodeID nodeId = node->getId();
+    const ConstraintNode::EdgeRecordVec& loads = node->getLoadOutRecords();
+    const ConstraintNode::EdgeRecordVec& stores = node->getStoreInRecords();
     for (PointsTo::iterator piter = getPts(nodeId).begin(), epiter =
                 getPts(nodeId).end(); piter != epiter; ++piter)
     {
         NodeID ptd = *piter;
         // handle load
-        for (ConstraintNode::const_iterator it = node->outgoingLoadsBegin(),
-                eit = node->outgoingLoadsEnd(); it != eit; ++it)
+        for (const ConstraintNode::EdgeRecord& load : loads)
         {
-            if (processLoad(ptd, *it))
+            if (Andersen::processLoad(ptd, load.edge))
                 pushIntoWorklist(ptd);
         }
 
         // handle store
-        for (ConstraintNode::const_iterator it = node->incomingStoresBegin(),
-                eit = node->incomingStoresEnd(); it != eit; ++it)
+        for (const ConstraintNode::EdgeRecord& store : stores)
         {
-            if (processStore(ptd, *it))
-                pushIntoWorklist((*it)->getSrcID());
+            if (Andersen::processStore(ptd, store.edge))
+                pushIntoWorklist(store.node);
         }
     }
 }
@@ -468,7 +471,7 @@ inline void Andersen::collapsePWCNode(NodeID nodeId)
         reanalyze = true;
 }
 
-inline void Andersen::collapseFields()
+void Andersen::collapseFields()
 {
     while (consCG->hasNodesToBeCollapsed())
     {
@@ -523,6 +526,174 @@ void Andersen::mergeSccNodes(NodeID repNodeId, const NodeBS& subNodes)
     }
 }
 
+/*!
+ * Offline variable substitution by hash-based value numbering (HVN).
+ * Every node is labelled with the set of points-to labels it receives offline:
+ * one per address-taken object, one per (source value number, offset) field
+ * access, those of its copy predecessors, and a fresh one if its points-to set
+ * also depends on loads or on-the-fly call edges. Label sets are hash-consed
+ * into value numbers in topological order of the copy/gep SCCs, and nodes
+ * with the same value number are pointer-equivalent and merged into one rep.
+ */
+void Andersen::mergeOfflineEquivalentNodes()
+{
+    double start = stat->getClk();
+    u32_t numOfEdges = consCG->getAddrCGEdges().size() + consCG->getDirectCGEdges().size()
+                       + consCG->getLoadCGEdges().size() + consCG->getStoreCGEdges().size();
+
+    NodeBS indirectNodes;
+    collectIndirectNodes(indirectNodes);
+
+    /// value number 0 is the empty label set, i.e., a node which never points to anything
+    std::vector<NodeBS> labelSets(1);
+    Map<NodeBS, u32_t> labelSetToVN;
+    labelSetToVN[NodeBS()] = 0;
+    u32_t numOfLabels = 0;
+    Map<NodeID, u32_t> addrLabels;
+    Map<std::pair<u32_t, s32_t>, u32_t> gepLabels;
+    Map<u32_t, u32_t> variantGepLabels;
+    Map<NodeID, u32_t> nodeToVN;
+
+    getSCCDetector()->find();
+    NodeStack topoOrder = getSCCDetector()->topoNodeStack();
+    while (!topoOrder.empty())
+    {
+        NodeID repNodeId = topoOrder.top();
+        topoOrder.pop();
+        const NodeBS& subNodes = getSCCDetector()->subNodes(repNodeId);
+
+        NodeBS labels;
+        bool indirect = false;
+        bool gepInCycle = false;
+        for (NodeID subNodeId : subNodes)
+        {
+            const ConstraintNode* node = consCG->getConstraintNode(subNodeId);
+            if (indirectNodes.test(subNodeId))
+                indirect = true;
+            for (const ConstraintEdge* addr : node->getAddrInEdges())
+            {
+                std::pair<Map<NodeID, u32_t>::iterator, bool> res = addrLabels.emplace(addr->getSrcID(), numOfLabels);
+                if (res.second)
+                    numOfLabels++;
+                labels.set(res.first->second);
+            }
+            for (const ConstraintEdge* edge : node->getDirectInEdges())
+            {
+                if (getSCCDetector()->repNode(edge->getSrcID()) == repNodeId)
+                {
+                    if (SVFUtil::isa<GepCGEdge>(edge))
+                        gepInCycle = true;
+                    continue;
+                }
+                /// predecessors outside the SCC have been numbered
+                Map<NodeID, u32_t>::const_iterator srcIt = nodeToVN.find(edge->getSrcID());
+                assert(srcIt != nodeToVN.end() && "source not visited in topological order?");
+                u32_t srcVN = srcIt->second;
+                if (srcVN == 0)
+                    continue;
+
+                if (SVFUtil::isa<CopyCGEdge>(edge))
+                    labels |= labelSets[srcVN];
+                else if (const NormalGepCGEdge* gep = SVFUtil::dyn_cast<NormalGepCGEdge>(edge))
+                {
+                    std::pair<Map<std::pair<u32_t, s32_t>, u32_t>::iterator, bool> res =
+                        gepLabels.emplace(std::make_pair(srcVN, gep->getConstantFieldIdx()), numOfLabels);
+                    if (res.second)
+                        numOfLabels++;
+                    labels.set(res.first->second);
+                }
+                else
+                {
+                    std::pair<Map<u32_t, u32_t>::iterator, bool> res = variantGepLabels.emplace(srcVN, numOfLabels);
+                    if (res.second)
+                        numOfLabels++;
+                    labels.set(res.first->second);
+                }
+            }
+        }
+
+        if (gepInCycle)
+        {
+            /// field accesses inside the cycle, the members are left to online PWC handling
+            for (NodeID subNodeId : subNodes)
+            {
+                NodeBS own;
+                own.set(numOfLabels++);
+                nodeToVN[subNodeId] = labelSets.size();
+                labelSetToVN.emplace(own, labelSets.size());
+                labelSets.push_back(own);
+            }
+            continue;
+        }
+
+        if (indirect)
+            labels.set(numOfLabels++);
+        std::pair<Map<NodeBS, u32_t>::iterator, bool> res = labelSetToVN.emplace(labels, labelSets.size());
+        if (res.second)
+            labelSets.push_back(labels);
+        for (NodeID subNodeId : subNodes)
+            nodeToVN[subNodeId] = res.first->second;
+    }
+
+    /// merge every node into the first node (by id) with the same value number
+    NodeBS cgNodes;
+    for (ConstraintGraph::const_iterator nodeIt = consCG->begin(), nodeEit = consCG->end(); nodeIt != nodeEit; nodeIt++)
+        cgNodes.set(nodeIt->first);
+    Map<u32_t, NodeID> vnToRep;
+    for (NodeID nodeId : cgNodes)
+    {
+        std::pair<Map<u32_t, NodeID>::iterator, bool> res = vnToRep.emplace(nodeToVN[nodeId], nodeId);
+        if (res.second)
+            continue;
+        mergeNodeToRep(nodeId, res.first->second);
+        numOfHVNMergedNodes++;
+    }
+
+    numOfHVNRemovedEdges += numOfEdges - (consCG->getAddrCGEdges().size() + consCG->getDirectCGEdges().size()
+                                          + consCG->getLoadCGEdges().size() + consCG->getStoreCGEdges().size());
+    double end = stat->getClk();
+    timeOfHVN += (end - start) / TIMEINTERVAL;
+}
+
+/*!
+ * Nodes whose points-to sets are not determined by the offline graph: objects
+ * (targets of stores), destinations of loads, and the formal parameters and
+ * callsite returns connected on the fly for indirect calls.
+ */
+void Andersen::collectIndirectNodes(NodeBS& indirectNodes)
+{
+    for (ConstraintGraph::const_iterator nodeIt = consCG->begin(), nodeEit = consCG->end(); nodeIt != nodeEit; nodeIt++)
+    {
+        NodeID nodeId = nodeIt->first;
+        const ConstraintNode* node = nodeIt->second;
+        if (SVFUtil::isa<ObjVar>(pag->getGNode(nodeId)) || !node->getLoadInEdges().empty())
+            indirectNodes.set(nodeId);
+
+        /// parameters of address-taken functions
+        for (const ConstraintEdge* addr : node->getAddrInEdges())
+        {
+            const MemObj* obj = pag->getObject(addr->getSrcID());
+            if (obj == nullptr || !obj->isFunction())
+                continue;
+            const SVFFunction* fun = SVFUtil::cast<SVFFunction>(obj->getValue())->getDefFunForMultipleModule();
+            if (pag->hasFunArgsList(fun))
+            {
+                for (const SVFVar* arg : pag->getFunArgsList(fun))
+                    indirectNodes.set(arg->getId());
+            }
+            if (fun->isVarArg())
+                indirectNodes.set(pag->getVarargNode(fun));
+        }
+    }
+
+    for (const auto& item : pag->getIndirectCallsites())
+    {
+        const RetICFGNode* retNode = item.first->getRetICFGNode();
+        if (pag->callsiteHasRet(retNode))
+            indirectNodes.set(pag->getCallSiteRet(retNode)->getId());
+    }
+}
+
 /**
  * Collapse node's points-to set. Change all points-to elements into field-insensitive.
  */
@@ -628,6 +799,30 @@ NodeStack& Andersen::SCCDetect()
     return getSCCDetector()->topoNodeStack();
 }
 
+/*!
+ * SCC detection on the part of the constraint graph reachable from candidates
+ */
+NodeStack& Andersen::SCCDetect(NodeSet& candidates)
+{
+    numOfSCCDetection++;
+
+    double sccStart = stat->getClk();
+    WPAConstraintSolver::SCCDetect(candidates);
+    double sccEnd = stat->getClk();
+
+    timeOfSCCDetection +=  (sccEnd - sccStart)/TIMEINTERVAL;
+
+    double mergeStart = stat->getClk();
+
+    mergeSccCycle();
+
+    double mergeEnd = stat->getClk();
+
+    timeOfSCCMerges +=  (mergeEnd - mergeStart)/TIMEINTERVAL;
+
+    return getSCCDetector()->topoNodeStack();
+}
+
 /*!
  * Update call graph for the input indirect callsites
  */
@@ -861,6 +1056,22 @@ void Andersen::cluster(void) const
     PointsTo::setCurrentBestNodeMapping(nodeMapping, reverseNodeMapping);
 }
 
+void Andersen::reorder(void)
+{
+    // A mapping installed by an earlier Andersen's run (e.g., the auxiliary
+    // analysis of FS) is kept so that all points-to sets share it.
+    if (PointsTo::getCurrentBestNodeMapping() != nullptr) return;
+
+    PointsTo::MappingPtr nodeMapping =
+        std::make_shared<std::vector<NodeID>>(NodeIDAllocator::Reorderer::reorder(consCG, Options::NodeReorder()));
+    PointsTo::MappingPtr reverseNodeMapping =
+        std::make_shared<std::vector<NodeID>>(NodeIDAllocator::Clusterer::getReverseNodeMapping(*nodeMapping));
+
+    PointsTo::setCurrentBestNodeMapping(nodeMapping, reverseNodeMapping);
+    // The cached empty set was created before the mapping, so re-create it.
+    getPtCache().reset();
+}
+
 /*!
  * Print pag nodes' pts by an ascending order
  */
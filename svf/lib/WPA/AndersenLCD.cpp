@@ -0,0 +1,279 @@
+//===- AndersenLCD.cpp -- Lazy and hybrid cycle detection Andersen's analysis//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013->  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * AndersenLCD.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: SVF team
+ */
+
+#include "WPA/AndersenLCD.h"
+#include "MemoryModel/PointsTo.h"
+#include "Util/Options.h"
+
+using namespace SVF;
+using namespace SVFUtil;
+using namespace std;
+
+/*!
+ * Process a node, then search the cycles through the candidates it produced
+ */
+void AndersenLCD::processNode(NodeID nodeId)
+{
+    Andersen::processNode(nodeId);
+
+    if (!lcdCandidates.empty())
+        SCCDetect();
+}
+
+/*!
+ * Propagate along copy and gep edges with the cycle-candidate check on copies
+ */
+void AndersenLCD::handleCopyGep(ConstraintNode* node)
+{
+    propagateDiffPts(node, [this](NodeID nodeId, const ConstraintEdge* copy)
+    {
+        AndersenLCD::processCopy(nodeId, copy);
+    });
+}
+
+/*!
+ * A copy edge which changes nothing and whose two ends have the same
+ * points-to set may close a cycle, its dst becomes a cycle candidate.
+ */
+bool AndersenLCD::processCopy(NodeID node, const ConstraintEdge* edge)
+{
+    bool changed = Andersen::processCopy(node, edge);
+
+    NodeID dst = edge->getDstID();
+    if (!changed && getPts(node) == getPts(dst) && checkedEdges.insert(std::make_pair(node, dst)).second)
+        lcdCandidates.insert(sccRepNode(dst));
+
+    return changed;
+}
+
+/*!
+ * SCC detection starting from the lazy cycle candidates only
+ */
+NodeStack& AndersenLCD::SCCDetect()
+{
+    numOfSCCDetection++;
+
+    double sccStart = stat->getClk();
+    getSCCDetector()->find(lcdCandidates);
+    lcdCandidates.clear();
+    double sccEnd = stat->getClk();
+    timeOfSCCDetection += (sccEnd - sccStart) / TIMEINTERVAL;
+
+    double mergeStart = stat->getClk();
+    mergeSccCycle();
+    /// the rep of a collapsed cycle has to propagate what its sub nodes had not
+    for (NodeID repNodeId : getSCCDetector()->getRepNodes())
+        pushIntoWorklist(repNodeId);
+    double mergeEnd = stat->getClk();
+    timeOfSCCMerges += (mergeEnd - mergeStart) / TIMEINTERVAL;
+
+    return getSCCDetector()->topoNodeStack();
+}
+
+/*!
+ * Initialize analysis, then run the offline part of HCD
+ */
+void AndersenHCD::initialize()
+{
+    AndersenLCD::initialize();
+
+    double sccStart = stat->getClk();
+    offlineCycleDetect();
+    double sccEnd = stat->getClk();
+    timeOfSCCDetection += (sccEnd - sccStart) / TIMEINTERVAL;
+}
+
+/*!
+ * Tarjan's SCC detection on the offline graph, where ref node *p is p + refBase.
+ * Cycles made of non-ref nodes only are merged right away; a cycle through
+ * ref nodes records *a -> b for its ref nodes and one of its non-ref nodes b.
+ */
+void AndersenHCD::offlineCycleDetect()
+{
+    NodeID refBase = 0;
+    for (ConstraintGraph::const_iterator nodeIt = consCG->begin(), nodeEit = consCG->end(); nodeIt != nodeEit; nodeIt++)
+        refBase = std::max(refBase, nodeIt->first + 1);
+
+    Map<NodeID, std::vector<NodeID>> succs;
+    for (ConstraintGraph::const_iterator nodeIt = consCG->begin(), nodeEit = consCG->end(); nodeIt != nodeEit; nodeIt++)
+    {
+        NodeID nodeId = nodeIt->first;
+        const ConstraintNode* node = nodeIt->second;
+        for (const ConstraintEdge* edge : node->getCopyOutEdges())
+            succs[nodeId].push_back(edge->getDstID());
+        /// p --load--> q: *p -> q
+        for (const ConstraintEdge* edge : node->getLoadOutEdges())
+            succs[nodeId + refBase].push_back(edge->getDstID());
+        /// q --store--> p: q -> *p
+        for (const ConstraintEdge* edge : node->getStoreInEdges())
+            succs[edge->getSrcID()].push_back(nodeId + refBase);
+    }
+
+    Map<NodeID, u32_t> index;
+    Map<NodeID, u32_t> lowLink;
+    std::vector<NodeID> sccStack;
+    NodeBS onStack;
+    u32_t nextIndex = 0;
+    std::vector<std::pair<NodeID, NodeID>> copyCycleMerges;
+
+    for (const auto& item : succs)
+    {
+        if (index.find(item.first) != index.end())
+            continue;
+
+        /// (node, index of its next successor)
+        std::vector<std::pair<NodeID, u32_t>> visitStack;
+        visitStack.push_back(std::make_pair(item.first, 0));
+        index[item.first] = lowLink[item.first] = nextIndex++;
+        sccStack.push_back(item.first);
+        onStack.set(item.first);
+
+        while (!visitStack.empty())
+        {
+            NodeID v = visitStack.back().first;
+            Map<NodeID, std::vector<NodeID>>::const_iterator vit = succs.find(v);
+            if (vit != succs.end() && visitStack.back().second < vit->second.size())
+            {
+                NodeID w = vit->second[visitStack.back().second++];
+                if (index.find(w) == index.end())
+                {
+                    index[w] = lowLink[w] = nextIndex++;
+                    sccStack.push_back(w);
+                    onStack.set(w);
+                    visitStack.push_back(std::make_pair(w, 0));
+                }
+                else if (onStack.test(w))
+                    lowLink[v] = std::min(lowLink[v], index[w]);
+                continue;
+            }
+
+            visitStack.pop_back();
+            if (!visitStack.empty())
+            {
+                NodeID u = visitStack.back().first;
+                lowLink[u] = std::min(lowLink[u], lowLink[v]);
+            }
+            if (lowLink[v] != index[v])
+                continue;
+
+            std::vector<NodeID> scc;
+            NodeID w;
+            do
+            {
+                w = sccStack.back();
+                sccStack.pop_back();
+                onStack.reset(w);
+                scc.push_back(w);
+            }
+            while (w != v);
+            if (scc.size() == 1)
+                continue;
+
+            /// there is no ref-to-ref edge, so every cycle has a non-ref node
+            NodeID target = refBase;
+            bool hasRef = false;
+            for (NodeID n : scc)
+            {
+                if (n >= refBase)
+                    hasRef = true;
+                else
+                    target = std::min(target, n);
+            }
+            assert(target < refBase && "cycle of ref nodes only?");
+            for (NodeID n : scc)
+            {
+                if (n >= refBase)
+                    hcdTargets[n - refBase] = target;
+                else if (!hasRef && n != target)
+                    copyCycleMerges.push_back(std::make_pair(n, target));
+            }
+        }
+    }
+
+    for (const std::pair<NodeID, NodeID>& merge : copyCycleMerges)
+    {
+        NodeID nodeId = sccRepNode(merge.first);
+        NodeID repNodeId = sccRepNode(merge.second);
+        if (nodeId != repNodeId)
+            mergeNodeToRep(nodeId, repNodeId);
+    }
+}
+
+/*!
+ * If *nodeId is in an offline cycle with b, merge every object nodeId points to with b
+ */
+void AndersenHCD::processNode(NodeID nodeId)
+{
+    if (sccRepNode(nodeId) != nodeId)
+        return;
+
+    Map<NodeID, NodeID>::const_iterator it = hcdTargets.find(nodeId);
+    if (it != hcdTargets.end())
+    {
+        double mergeStart = stat->getClk();
+        NodeID target = sccRepNode(it->second);
+        /// merging may change the points-to set of nodeId
+        const PointsTo pts = getPts(nodeId);
+        bool merged = false;
+        for (NodeID ptd : pts)
+        {
+            /// no copy edge is ever added for these objects, see processLoad/processStore
+            if (pag->isConstantObj(ptd) || isNonPointerObj(ptd))
+                continue;
+            NodeID ptdRep = sccRepNode(ptd);
+            if (ptdRep == target)
+                continue;
+            mergeNodeToRep(ptdRep, target);
+            numOfHCDMerges++;
+            merged = true;
+        }
+        if (merged)
+            pushIntoWorklist(target);
+        double mergeEnd = stat->getClk();
+        timeOfSCCMerges += (mergeEnd - mergeStart) / TIMEINTERVAL;
+    }
+
+    AndersenLCD::processNode(nodeId);
+}
+
+/*!
+ * Merge a node to its rep, the rep inherits the offline target of the node
+ */
+void AndersenHCD::mergeNodeToRep(NodeID nodeId, NodeID newRepId)
+{
+    AndersenLCD::mergeNodeToRep(nodeId, newRepId);
+
+    Map<NodeID, NodeID>::iterator it = hcdTargets.find(nodeId);
+    if (it != hcdTargets.end())
+    {
+        NodeID target = it->second;
+        hcdTargets.erase(it);
+        hcdTargets.emplace(newRepId, target);
+    }
+}
@@ -181,20 +181,17 @@ void AndersenSCD::processPWC(ConstraintNode* rep)
         if (!getDiffPts(nodeId).empty())
         {
             ConstraintNode *node = consCG->getConstraintNode(nodeId);
-            for (ConstraintEdge* edge : node->getCopyOutEdges())
+            for (const ConstraintNode::EdgeRecord& copy : node->getCopyOutRecords())
             {
-                bool changed = processCopy(nodeId, edge);
-                if (changed && pwcNodes.find(edge->getDstID()) != pwcNodes.end())
-                    tmpWorkList.push(edge->getDstID());
+                bool changed = Andersen::processCopy(nodeId, copy.edge);
+                if (changed && pwcNodes.find(copy.node) != pwcNodes.end())
+                    tmpWorkList.push(copy.node);
             }
-            for (ConstraintEdge* edge : node->getGepOutEdges())
+            for (const ConstraintNode::EdgeRecord& gep : node->getGepOutRecords())
             {
-                if (GepCGEdge *gepEdge = SVFUtil::dyn_cast<GepCGEdge>(edge))
-                {
-                    bool changed = processGep(nodeId, gepEdge);
-                    if (changed && pwcNodes.find(edge->getDstID()) != pwcNodes.end())
-                        tmpWorkList.push(edge->getDstID());
-                }
+                bool changed = Andersen::processGep(nodeId, SVFUtil::cast<GepCGEdge>(gep.edge));
+                if (changed && pwcNodes.find(gep.node) != pwcNodes.end())
+                    tmpWorkList.push(gep.node);
             }
         }
     }
@@ -211,26 +208,24 @@ void AndersenSCD::handleLoadStore(ConstraintNode* node)
 
     NodeID nodeId = node->getId();
     // handle load
-    for (ConstraintNode::const_iterator it = node->outgoingLoadsBegin(),
-            eit = node->outgoingLoadsEnd(); it != eit; ++it)
+    for (const ConstraintNode::EdgeRecord& load : node->getLoadOutRecords())
         for (PointsTo::iterator piter = getPts(nodeId).begin(), epiter =
                     getPts(nodeId).end(); piter != epiter; ++piter)
         {
             NodeID ptd = *piter;
-            if (processLoad(ptd, *it))
+            if (Andersen::processLoad(ptd, load.edge))
             {
                 reanalyze = true;
             }
         }
 
     // handle store
-    for (ConstraintNode::const_iterator it = node->incomingStoresBegin(),
-            eit = node->incomingStoresEnd(); it != eit; ++it)
+    for (const ConstraintNode::EdgeRecord& store : node->getStoreInRecords())
         for (PointsTo::iterator piter = getPts(nodeId).begin(), epiter =
                     getPts(nodeId).end(); piter != epiter; ++piter)
         {
             NodeID ptd = *piter;
-            if (processStore(ptd, *it))
+            if (Andersen::processStore(ptd, store.edge))
             {
                 reanalyze = true;
             }
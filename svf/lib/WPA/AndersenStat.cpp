@@ -314,6 +314,8 @@ void AndersenStat::performStat()
     timeStatMap["LoadStoreTime"] =  Andersen::timeOfProcessLoadStore;
     timeStatMap["CopyGepTime"] =  Andersen::timeOfProcessCopyGep;
     timeStatMap["UpdateCGTime"] =  Andersen::timeOfUpdateCallGraph;
+    timeStatMap["PropagationTime"] =  Andersen::timeOfProcessCopyGep + Andersen::timeOfProcessLoadStore;
+    timeStatMap["HVNTime"] =  Andersen::timeOfHVN;
 
     PTNumStatMap["TotalPointers"] = pag->getValueNodeNum() + pag->getFieldValNodeNum();
     PTNumStatMap["TotalObjects"] = pag->getObjectNodeNum() + pag->getFieldObjNodeNum();
@@ -328,6 +330,9 @@ void AndersenStat::performStat()
     PTNumStatMap["NumOfSFRs"] = Andersen::numOfSfrs;
     PTNumStatMap["NumOfFieldExpand"] = Andersen::numOfFieldExpand;
 
+    PTNumStatMap["HVNMergedNodes"] = Andersen::numOfHVNMergedNodes;
+    PTNumStatMap["HVNRemovedEdges"] = Andersen::numOfHVNRemovedEdges;
+
     PTNumStatMap["Pointers"] = pag->getValueNodeNum();
     PTNumStatMap["MemObjects"] = pag->getObjectNodeNum();
     PTNumStatMap["DummyFieldPtrs"] = pag->getFieldValNodeNum();
@@ -344,6 +349,7 @@ void AndersenStat::performStat()
     PTNumStatMap["IndEdgeSolved"] = pta->getNumOfResolvedIndCallEdge();
 
     PTNumStatMap["NumOfSCCDetect"] = Andersen::numOfSCCDetection;
+    PTNumStatMap["HCDMergedNodes"] = Andersen::numOfHCDMerges;
     PTNumStatMap["TotalCycleNum"] = _NumOfCycles;
     PTNumStatMap["TotalPWCCycleNum"] = _NumOfPWCCycles;
     PTNumStatMap["NodesInCycles"] = _NumOfNodesInCycles;
@@ -43,6 +43,8 @@ void AndersenWaveDiff::initialize()
 {
     Andersen::initialize();
     setDetectPWC(true);   // Standard wave propagation always collapses PWCs
+    waveCandidates.clear();
+    fullWave = true;
 }
 
 /*!
@@ -52,7 +54,12 @@ void AndersenWaveDiff::solveWorklist()
 {
     // Initialize the nodeStack via a whole SCC detection
     // Nodes in nodeStack are in topological order by default.
-    NodeStack& nodeStack = SCCDetect();
+    // Later waves only need the nodes reachable from new copy edges.
+    NodeSet candidateReps;
+    for (NodeID n : waveCandidates) candidateReps.insert(sccRepNode(n));
+    NodeStack& nodeStack = (fullWave || !Options::IncrementalCallGraph()) ? SCCDetect() : SCCDetect(candidateReps);
+    waveCandidates.clear();
+    fullWave = false;
 
     // Process nodeStack and put the changed nodes into workList.
     while (!nodeStack.empty())
@@ -74,6 +81,16 @@ void AndersenWaveDiff::solveWorklist()
     }
 }
 
+/*!
+ * Collapse fields, falling back to a full next wave if any is collapsed
+ */
+void AndersenWaveDiff::collapseFields()
+{
+    if (consCG->hasNodesToBeCollapsed())
+        fullWave = true;
+    Andersen::collapseFields();
+}
+
 /*!
  * Process edge PAGNode
  */
@@ -101,17 +118,15 @@ void AndersenWaveDiff::postProcessNode(NodeID nodeId)
     ConstraintNode* node = consCG->getConstraintNode(nodeId);
 
     // handle load
-    for (ConstraintNode::const_iterator it = node->outgoingLoadsBegin(), eit = node->outgoingLoadsEnd();
-            it != eit; ++it)
+    for (const ConstraintNode::EdgeRecord& load : node->getLoadOutRecords())
     {
-        if (handleLoad(nodeId, *it))
+        if (handleLoad(nodeId, load.edge))
             reanalyze = true;
     }
     // handle store
-    for (ConstraintNode::const_iterator it = node->incomingStoresBegin(), eit =  node->incomingStoresEnd();
-            it != eit; ++it)
+    for (const ConstraintNode::EdgeRecord& store : node->getStoreInRecords())
     {
-        if (handleStore(nodeId, *it))
+        if (handleStore(nodeId, store.edge))
             reanalyze = true;
     }
 
@@ -128,7 +143,7 @@ bool AndersenWaveDiff::handleLoad(NodeID nodeId, const ConstraintEdge* edge)
     for (PointsTo::iterator piter = getPts(nodeId).begin(), epiter = getPts(nodeId).end();
             piter != epiter; ++piter)
     {
-        if (processLoad(*piter, edge))
+        if (Andersen::processLoad(*piter, edge))
         {
             changed = true;
         }
@@ -145,7 +160,7 @@ bool AndersenWaveDiff::handleStore(NodeID nodeId, const ConstraintEdge* edge)
     for (PointsTo::iterator piter = getPts(nodeId).begin(), epiter = getPts(nodeId).end();
             piter != epiter; ++piter)
     {
-        if (processStore(*piter, edge))
+        if (Andersen::processStore(*piter, edge))
         {
             changed = true;
         }
@@ -68,6 +68,12 @@ void FlowSensitive::initialize()
         // As above.
         getPtCache().reset();
     }
+    else if (Options::NodeReorder() != NodeIDAllocator::Reordering::NO_REORDER)
+    {
+        // The auxiliary Andersen's installed the reordering mapping after
+        // our cache was created.
+        getPtCache().reset();
+    }
 
     svfg = memSSA.buildPTROnlySVFG(ander);
 
@@ -80,12 +86,14 @@ void FlowSensitive::initialize()
  */
 void FlowSensitive::analyze()
 {
-    bool limitTimerSet = SVFUtil::startAnalysisLimitTimer(Options::FsTimeLimit());
+    /// Anytime analysis checks its own budget instead of being killed by the alarm
+    bool limitTimerSet = !Options::FsAnytime() && SVFUtil::startAnalysisLimitTimer(Options::FsTimeLimit());
 
     /// Initialization for the Solver
     initialize();
 
     double start = stat->getClk(true);
+    budgetDeadline = start + Options::FsTimeLimit() * 1000.0;
     /// Start solving constraints
     DBOUT(DGENERAL, outs() << SVFUtil::pasMsg("Start Solving Constraints\n"));
 
@@ -101,7 +109,10 @@ void FlowSensitive::analyze()
         initWorklist();
         solveWorklist();
     }
-    while (updateCallGraph(getIndirectCallsites()));
+    while (!budgetExhausted && updateCallGraph(getIndirectCallsites()));
+
+    if (budgetExhausted)
+        fallBackToAndersen();
 
     DBOUT(DGENERAL, outs() << SVFUtil::pasMsg("Finish Solving Constraints\n"));
 
@@ -139,7 +150,7 @@ void FlowSensitive::finalize()
     }
 
     // TODO: check -stat too.
-    if (Options::ClusterFs())
+    if (Options::ClusterFs() || Options::NodeReorder() != NodeIDAllocator::Reordering::NO_REORDER)
     {
         Map<std::string, std::string> stats;
         const PTDataTy *ptd = getPTDataTy();
@@ -159,6 +170,142 @@ void FlowSensitive::finalize()
     }
 
     BVDataPTAImpl::finalize();
+
+    if (Options::FreezePts())
+        freezePointsTo();
+}
+
+/// Number of nodes processed between two budget checks
+static const u32_t budgetCheckInterval = 1024;
+
+/*!
+ * Solve the worklist, checking the budget of anytime analysis now and then
+ */
+void FlowSensitive::solveWorklist()
+{
+    if (!Options::FsAnytime())
+    {
+        WPASVFGFSSolver::solveWorklist();
+        return;
+    }
+
+    u32_t numOfProcessedNodes = 0;
+    while (!isWorklistEmpty())
+    {
+        if (++numOfProcessedNodes % budgetCheckInterval == 0 && isBudgetExhausted())
+        {
+            budgetExhausted = true;
+            return;
+        }
+        processNode(popFromWorklist());
+        collapseFields();
+    }
+}
+
+/*!
+ * The time budget is -fs-time-limit seconds of solving, the memory budget is
+ * -fs-mem-limit MB of resident memory; 0 means no limit.
+ */
+bool FlowSensitive::isBudgetExhausted() const
+{
+    if (Options::FsTimeLimit() != 0 && stat->getClk(true) > budgetDeadline)
+        return true;
+
+    u32_t vmrss = 0, vmsize = 0;
+    if (Options::FsMemLimit() != 0 && SVFUtil::getMemoryUsageKB(&vmrss, &vmsize))
+        return vmrss / 1024 > Options::FsMemLimit();
+
+    return false;
+}
+
+/*!
+ * Nodes which may still change are the nodes left in the worklist, the nodes
+ * at indirect calls Andersen's resolved but FS has not connected yet, and
+ * everything reachable from them.
+ */
+void FlowSensitive::collectUnconvergedNodes(NodeBS& unconverged)
+{
+    while (!isWorklistEmpty())
+        unconverged.set(popFromWorklist());
+
+    auto addDefNode = [&](const PAGNode* var)
+    {
+        if (svfg->hasDefSVFGNode(var))
+            unconverged.set(svfg->getDefSVFGNode(var)->getId());
+    };
+
+    const CallEdgeMap& connectedEdges = getIndCallMap();
+    for (const CallEdgeMap::value_type& item : ander->getIndCallMap())
+    {
+        const CallICFGNode* cs = item.first;
+        CallEdgeMap::const_iterator csIt = connectedEdges.find(cs);
+        for (const SVFFunction* callee : item.second)
+        {
+            if (csIt != connectedEdges.end() && csIt->second.count(callee))
+                continue;
+
+            if (pag->hasFunArgsList(callee))
+            {
+                for (const PAGNode* arg : pag->getFunArgsList(callee))
+                    addDefNode(arg);
+            }
+            if (callee->isVarArg())
+                addDefNode(pag->getGNode(pag->getVarargNode(callee)));
+            if (pag->callsiteHasRet(cs->getRetICFGNode()))
+                addDefNode(pag->getCallSiteRet(cs->getRetICFGNode()));
+            if (svfg->hasFormalINSVFGNodes(callee))
+                unconverged |= svfg->getFormalINSVFGNodes(callee);
+            if (svfg->hasActualOUTSVFGNodes(cs))
+                unconverged |= svfg->getActualOUTSVFGNodes(cs);
+        }
+    }
+
+    addReachableNodes(unconverged);
+}
+
+/*!
+ * Forward closure of nodes on the SVFG
+ */
+void FlowSensitive::addReachableNodes(NodeBS& nodes) const
+{
+    FIFOWorkList<NodeID> worklist;
+    for (NodeID n : nodes)
+        worklist.push(n);
+
+    while (!worklist.empty())
+    {
+        const SVFGNode* node = svfg->getSVFGNode(worklist.pop());
+        for (const SVFGEdge* edge : node->getOutEdges())
+        {
+            if (nodes.test_and_set(edge->getDstID()))
+                worklist.push(edge->getDstID());
+        }
+    }
+}
+
+/*!
+ * Anytime analysis ran out of budget: the pointers defined at converged nodes
+ * keep their flow-sensitive points-to sets and the others get Andersen's,
+ * which over-approximates whatever the rest of the analysis would have found.
+ */
+void FlowSensitive::fallBackToAndersen()
+{
+    NodeBS unconverged;
+    collectUnconvergedNodes(unconverged);
+
+    for (SVFIR::iterator it = pag->begin(), eit = pag->end(); it != eit; ++it)
+    {
+        const PAGNode* pagNode = it->second;
+        if (!SVFUtil::isa<ValVar>(pagNode) || !svfg->hasDefSVFGNode(pagNode))
+            continue;
+
+        numOfRefinablePtrs++;
+        if (unconverged.test(svfg->getDefSVFGNode(pagNode)->getId()))
+        {
+            unionPts(it->first, ander->getPts(it->first));
+            numOfFallbackPtrs++;
+        }
+    }
 }
 
 /*!
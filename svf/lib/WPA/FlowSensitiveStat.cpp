@@ -175,6 +175,11 @@ void FlowSensitiveStat::performStat()
 
     PTNumStatMap["StrongUpdates"] = fspta->svfgHasSU.count();
 
+    PTNumStatMap["BudgetExhausted"] = fspta->budgetExhausted;
+    PTNumStatMap["FallbackPtrs"] = fspta->numOfFallbackPtrs;
+    timeStatMap["RefinedPtrPercent"] = fspta->numOfRefinablePtrs == 0 ? 100.0
+                                       : 100.0 * (fspta->numOfRefinablePtrs - fspta->numOfFallbackPtrs) / fspta->numOfRefinablePtrs;
+
     /// SVFG nodes.
     PTNumStatMap["SNodesHaveIN"] = _NumOfSVFGNodesHaveInOut[IN];
     PTNumStatMap["SNodesHaveOUT"] = _NumOfSVFGNodesHaveInOut[OUT];
@@ -46,58 +46,185 @@ void Steensgaard::solveWorklist()
     // Keep solving until workList is empty.
     while (!isWorklistEmpty())
     {
-        NodeID nodeId = popFromWorklist();
-        ConstraintNode* node = consCG->getConstraintNode(nodeId);
-
-        /// foreach o \in pts(p)
-        for(NodeID o : getPts(nodeId))
+        NodeID rep = getEC(popFromWorklist());
+        /// copy, as the unions below may change the points-to set of rep
+        const PointsTo pts = getPts(rep);
+
+        /// the constraints of every sub node of the EC. Unions splice other ECs
+        /// into the circular list, so the walk still ends at rep.
+        NodeID nodeId = rep;
+        do
         {
+            ConstraintNode* node = consCG->getConstraintNode(nodeId);
+
+            /// foreach o \in pts(p)
+            for(NodeID o : pts)
+            {
 
-            /// *p = q : EC(o) == EC(q)
-            for (ConstraintEdge* edge : node->getStoreInEdges())
+                /// *p = q : EC(o) == EC(q)
+                for (ConstraintEdge* edge : node->getStoreInEdges())
+                {
+                    ecUnion(edge->getSrcID(), o);
+                }
+                // r = *p : EC(r) == EC(o)
+                for (ConstraintEdge* edge : node->getLoadOutEdges())
+                {
+                    ecUnion(o, edge->getDstID());
+                }
+            }
+
+            /// q = p : EC(q) == EC(p)
+            for (ConstraintEdge* edge : node->getCopyOutEdges())
             {
-                ecUnion(edge->getSrcID(), o);
+                ecUnion(edge->getSrcID(),edge->getDstID());
             }
-            // r = *p : EC(r) == EC(o)
-            for (ConstraintEdge* edge : node->getLoadOutEdges())
+            /// q = &p->f : EC(q) == EC(p)
+            for (ConstraintEdge* edge : node->getGepOutEdges())
             {
-                ecUnion(o, edge->getDstID());
+                ecUnion(edge->getSrcID(),edge->getDstID());
             }
-        }
 
-        /// q = p : EC(q) == EC(p)
-        for (ConstraintEdge* edge : node->getCopyOutEdges())
-        {
-            ecUnion(edge->getSrcID(),edge->getDstID());
-        }
-        /// q = &p->f : EC(q) == EC(p)
-        for (ConstraintEdge* edge : node->getGepOutEdges())
-        {
-            ecUnion(edge->getSrcID(),edge->getDstID());
+            nodeId = getNextSubNode(nodeId);
         }
+        while (nodeId != rep);
     }
 }
 
+void Steensgaard::ensureEC(NodeID id)
+{
+    if (id < ecParent.size())
+        return;
+    size_t oldSize = ecParent.size();
+    size_t newSize = std::max((size_t) id + 1, 2 * oldSize);
+    ecParent.resize(newSize);
+    ecRank.resize(newSize, 0);
+    ecNext.resize(newSize);
+    for (size_t i = oldSize; i < newSize; ++i)
+    {
+        ecParent[i] = i;
+        ecNext[i] = i;
+    }
+}
 
-void Steensgaard::setEC(NodeID node, NodeID rep)
+NodeID Steensgaard::setEC(NodeID node, NodeID rep)
 {
+    node = getEC(node);
     rep = getEC(rep);
-    Set<NodeID>& subNodes = getSubNodes(node);
-    for(NodeID sub : subNodes)
+    if (node == rep)
+        return rep;
+
+    ensureEC(std::max(node, rep));
+    /// union by rank
+    if (ecRank[node] > ecRank[rep])
+        std::swap(node, rep);
+    else if (ecRank[node] == ecRank[rep])
+        ecRank[rep]++;
+    ecParent[node] = rep;
+    /// splice the two circular lists of sub nodes
+    std::swap(ecNext[node], ecNext[rep]);
+    numOfECUnions++;
+    return rep;
+}
+
+NodeBS Steensgaard::getSubNodes(NodeID id) const
+{
+    NodeBS subs;
+    NodeID rep = getEC(id);
+    NodeID sub = rep;
+    do
     {
-        nodeToECMap[sub] = rep;
-        addSubNode(rep,sub);
+        subs.set(sub);
+        sub = getNextSubNode(sub);
     }
-    subNodes.clear();
+    while (sub != rep);
+    return subs;
 }
 
 
 /// merge node into equiv class and merge node's pts into ec's pts
 void Steensgaard::ecUnion(NodeID node, NodeID ec)
 {
-    if(unionPts(ec, node))
-        pushIntoWorklist(ec);
-    setEC(node,ec);
+    node = getEC(node);
+    ec = getEC(ec);
+    if (node == ec)
+        return;
+
+    NodeID rep = setEC(node, ec);
+    NodeID sub = rep == ec ? node : ec;
+    /// points-to sets are only kept at representatives
+    getPTDataTy()->unionPts(rep, sub);
+    getPTDataTy()->clearFullPts(sub);
+    /// the constraints of the merged sub nodes are solved with the merged points-to set
+    pushIntoWorklist(rep);
+}
+
+/*!
+ * Update call graph for the input indirect callsites
+ */
+bool Steensgaard::updateCallGraph(const CallSiteToFunPtrMap& callsites)
+{
+    double cgUpdateStart = stat->getClk();
+
+    CallEdgeMap newEdges;
+    onTheFlyCallGraphSolve(callsites,newEdges);
+    for (const auto& csFuns : newEdges)
+    {
+        CallSite cs = SVFUtil::getSVFCallSite(csFuns.first->getCallSite());
+        for (const SVFFunction* callee : csFuns.second)
+            connectCaller2CalleeParams(cs, callee);
+    }
+
+    double cgUpdateEnd = stat->getClk();
+    timeOfUpdateCallGraph += (cgUpdateEnd - cgUpdateStart) / TIMEINTERVAL;
+
+    return (!newEdges.empty());
+}
+
+/*!
+ * Unify actual and formal parameters (and return values) of an indirect callsite.
+ * Unlike Andersen's, no copy edges are added: EC(actual) == EC(formal).
+ */
+void Steensgaard::connectCaller2CalleeParams(CallSite cs, const SVFFunction* F)
+{
+    assert(F);
+
+    CallICFGNode* callBlockNode = pag->getICFG()->getCallICFGNode(cs.getInstruction());
+    RetICFGNode* retBlockNode = pag->getICFG()->getRetICFGNode(cs.getInstruction());
+
+    if (pag->funHasRet(F) && pag->callsiteHasRet(retBlockNode))
+    {
+        const PAGNode* cs_return = pag->getCallSiteRet(retBlockNode);
+        const PAGNode* fun_return = pag->getFunRet(F);
+        if (cs_return->isPointer() && fun_return->isPointer())
+            ecUnion(fun_return->getId(), cs_return->getId());
+    }
+
+    if (pag->hasCallSiteArgsMap(callBlockNode) && pag->hasFunArgsList(F))
+    {
+        const SVFIR::SVFVarList& csArgList = pag->getCallSiteArgsList(callBlockNode);
+        const SVFIR::SVFVarList& funArgList = pag->getFunArgsList(F);
+        SVFIR::SVFVarList::const_iterator funArgIt = funArgList.begin(), funArgEit = funArgList.end();
+        SVFIR::SVFVarList::const_iterator csArgIt  = csArgList.begin(), csArgEit = csArgList.end();
+        for (; funArgIt != funArgEit && csArgIt != csArgEit; ++csArgIt, ++funArgIt)
+        {
+            const PAGNode *cs_arg = *csArgIt;
+            const PAGNode *fun_arg = *funArgIt;
+            if (cs_arg->isPointer() && fun_arg->isPointer())
+                ecUnion(cs_arg->getId(), fun_arg->getId());
+        }
+
+        //Any remaining actual args must be varargs.
+        if (F->isVarArg())
+        {
+            NodeID vaF = pag->getVarargNode(F);
+            for (; csArgIt != csArgEit; ++csArgIt)
+            {
+                const PAGNode *cs_arg = *csArgIt;
+                if (cs_arg->isPointer())
+                    ecUnion(cs_arg->getId(), vaF);
+            }
+        }
+    }
 }
 
 /*!
@@ -12,7 +12,7 @@
 #include "Util/Options.h"
 #include "MemoryModel/PointsTo.h"
 #include <iostream>
-#include <queue>
+#include <atomic>
 #include <thread>
 #include <mutex>
 
@@ -73,6 +73,11 @@ void VersionedFlowSensitive::finalize()
 void VersionedFlowSensitive::prelabel(void)
 {
     double start = stat->getClk(true);
+
+    assert(Options::VersioningThreads() > 0 && "VFS::prelabel: number of versioning threads must be > 0!");
+
+    // 1. Find the prelabeled nodes. This stays sequential as Andersen's getPts
+    //    may insert into its points-to map.
     for (SVFG::iterator it = svfg->begin(); it != svfg->end(); ++it)
     {
         NodeID l = it->first;
@@ -83,14 +88,10 @@ void VersionedFlowSensitive::prelabel(void)
             // l: *p = q.
             // If p points to o (Andersen's), l yields a new version for o.
             NodeID p = stn->getPAGDstNodeID();
-            for (NodeID o : ander->getPts(p))
-            {
-                prelabeledObjects.insert(o);
-            }
-
-            vWorklist.push(l);
+            const PointsTo &pPts = ander->getPts(p);
+            prelabeledNodes.push_back(std::make_pair(ln, &pPts));
 
-            if (ander->getPts(p).count() != 0) ++numPrelabeledNodes;
+            if (pPts.count() != 0) ++numPrelabeledNodes;
         }
         else if (delta(l))
         {
@@ -101,18 +102,61 @@ void VersionedFlowSensitive::prelabel(void)
             const MRSVFGNode *mr = SVFUtil::dyn_cast<MRSVFGNode>(ln);
             if (mr != nullptr)
             {
-                for (const NodeID o : mr->getPointsTo())
-                {
-                    prelabeledObjects.insert(o);
-                }
-
-                // Push into worklist because its consume == its yield.
-                vWorklist.push(l);
+                // Its consume == its yield.
+                prelabeledNodes.push_back(std::make_pair(ln, nullptr));
                 if (mr->getPointsTo().count() != 0) ++numPrelabeledNodes;
             }
         }
     }
 
+    // 2. Collect (object, prelabeled node) pairs in parallel, each thread taking
+    //    a contiguous chunk of prelabeledNodes.
+    const unsigned numThreads = Options::VersioningThreads();
+    const size_t chunkSize = (prelabeledNodes.size() + numThreads - 1) / numThreads;
+    std::vector<std::vector<std::pair<NodeID, const SVFGNode *>>> chunkPairs(numThreads);
+    auto prelabelWorker = [this, chunkSize, &chunkPairs](const unsigned thread)
+    {
+        std::vector<std::pair<NodeID, const SVFGNode *>> &pairs = chunkPairs[thread];
+        const size_t end = std::min(prelabeledNodes.size(), (thread + 1) * chunkSize);
+        for (size_t i = thread * chunkSize; i < end; ++i)
+        {
+            const SVFGNode *sn = prelabeledNodes[i].first;
+            const PointsTo *pts = prelabeledNodes[i].second;
+            if (pts != nullptr)
+            {
+                for (const NodeID o : *pts) pairs.push_back(std::make_pair(o, sn));
+            }
+            else
+            {
+                const MRSVFGNode *mr = SVFUtil::cast<MRSVFGNode>(sn);
+                for (const NodeID o : mr->getPointsTo()) pairs.push_back(std::make_pair(o, sn));
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (unsigned i = 0; i < numThreads; ++i) workers.push_back(std::thread(prelabelWorker, i));
+    for (std::thread &worker : workers) worker.join();
+
+    // 3. Build the object -> starting nodes index. Chunks are merged in order, so
+    //    the index is the same whatever the number of threads.
+    Map<NodeID, u32_t> objectIndex;
+    for (const std::vector<std::pair<NodeID, const SVFGNode *>> &pairs : chunkPairs)
+    {
+        for (const std::pair<NodeID, const SVFGNode *> &oSn : pairs)
+        {
+            const std::pair<Map<NodeID, u32_t>::iterator, bool> inserted
+                = objectIndex.emplace(oSn.first, prelabeledObjects.size());
+            if (inserted.second)
+            {
+                prelabeledObjects.push_back(oSn.first);
+                startingNodes.emplace_back();
+            }
+
+            startingNodes[inserted.first->second].push_back(oSn.second);
+        }
+    }
+
     double end = stat->getClk(true);
     prelabelingTime = (end - start) / TIMEINTERVAL;
 }
@@ -123,29 +167,11 @@ void VersionedFlowSensitive::meldLabel(void)
 
     assert(Options::VersioningThreads() > 0 && "VFS::meldLabel: number of versioning threads must be > 0!");
 
-    // Nodes which have at least one object on them given a prelabel + the Andersen's points-to
-    // set of interest so we don't keep calling getPts. For Store nodes, we'll fill that in, for
-    // MR nodes, we won't as its getPointsTo is cheap.
-    // TODO: preferably we cache both for ease and to avoid the dyn_cast/isa, but Andersen's points-to
-    // sets are PointsTo and MR's sets are NodeBS, which are incompatible types. Maybe when we can
-    // use std::option.
-    std::vector<std::pair<const SVFGNode *, const PointsTo *>> prelabeledNodes;
-    // Fast query for the above.
+    // Fast query for prelabeled nodes.
     std::vector<bool> isPrelabeled(svfg->getTotalNodeNum(), false);
-    while (!vWorklist.empty())
+    for (const std::pair<const SVFGNode *, const PointsTo *> &snPts : prelabeledNodes)
     {
-        const NodeID n = vWorklist.pop();
-        isPrelabeled[n] = true;
-
-        const SVFGNode *sn = svfg->getSVFGNode(n);
-        const PointsTo *nPts = nullptr;
-        if (const StoreSVFGNode *store = SVFUtil::dyn_cast<StoreSVFGNode>(sn))
-        {
-            const NodeID p = store->getPAGDstNodeID();
-            nPts = &(this->ander->getPts(p));
-        }
-
-        prelabeledNodes.push_back(std::make_pair(sn, nPts));
+        isPrelabeled[snPts.first->getId()] = true;
     }
 
     // Delta, delta source, store, and load nodes, which require versions during
@@ -159,81 +185,64 @@ void VersionedFlowSensitive::meldLabel(void)
 
     std::mutex *versionMutexes = new std::mutex[nodesWhichNeedVersions.size()];
 
-    // Map of footprints to the canonical object "owning" the footprint.
-    Map<std::vector<const IndirectSVFGEdge *>, NodeID> footprintOwner;
+    // Map of footprints to the canonical object "owning" the footprint, split into
+    // shards by footprint hash so that workers rarely wait on the same lock.
+    struct FootprintShard
+    {
+        std::mutex mutex;
+        Map<std::vector<const IndirectSVFGEdge *>, NodeID> footprintOwner;
+    };
+    const unsigned numThreads = Options::VersioningThreads();
+    std::vector<FootprintShard> footprintShards(4 * numThreads);
+    // canonicalObject[i] is the owner of the footprint of prelabeledObjects[i].
+    std::vector<NodeID> canonicalObject(prelabeledObjects.size());
 
-    std::queue<NodeID> objectQueue;
     for (const NodeID o : prelabeledObjects)
     {
         // "Touch" maps with o so we don't need to lock on them.
         versionReliance[o];
         stmtReliance[o];
-        objectQueue.push(o);
     }
 
-    std::mutex objectQueueMutex;
-    std::mutex footprintOwnerMutex;
+    // Objects are handed out by an atomic counter into prelabeledObjects.
+    std::atomic<size_t> nextObject(0);
 
-    auto meldVersionWorker = [this, &footprintOwner, &objectQueue,
-                                    &objectQueueMutex, &footprintOwnerMutex, &versionMutexes,
-                                    &prelabeledNodes, &isPrelabeled, &nodesWhichNeedVersions]
+    auto meldVersionWorker = [this, &footprintShards, &canonicalObject, &nextObject,
+                                    &versionMutexes, &isPrelabeled, &nodesWhichNeedVersions]
          (const unsigned thread)
     {
         while (true)
         {
-            NodeID o;
-            {
-                std::lock_guard<std::mutex> guard(objectQueueMutex);
-                // No more objects? Done.
-                if (objectQueue.empty()) return;
-                o = objectQueue.front();
-                objectQueue.pop();
-            }
+            const size_t oi = nextObject.fetch_add(1, std::memory_order_relaxed);
+            // No more objects? Done.
+            if (oi >= prelabeledObjects.size()) return;
+            const NodeID o = prelabeledObjects[oi];
 
             // 1. Compute the SCCs for the nodes on the graph overlay of o.
             // For starting nodes, we only need those which did prelabeling for o specifically.
-            // TODO: maybe we should move this to prelabel with a map (o -> starting nodes).
-            std::vector<const SVFGNode *> osStartingNodes;
-            for (std::pair<const SVFGNode *, const PointsTo *> snPts : prelabeledNodes)
-            {
-                const SVFGNode *sn = snPts.first;
-                const PointsTo *pts = snPts.second;
-                if (pts != nullptr)
-                {
-                    if (pts->test(o)) osStartingNodes.push_back(sn);
-                }
-                else if (const MRSVFGNode *mr = SVFUtil::dyn_cast<MRSVFGNode>(sn))
-                {
-                    if (mr->getPointsTo().test(o)) osStartingNodes.push_back(sn);
-                }
-                else
-                {
-                    assert(false && "VFS::meldLabel: unexpected prelabeled node!");
-                }
-            }
+            const std::vector<const SVFGNode *> &osStartingNodes = startingNodes[oi];
 
             std::vector<int> partOf;
             std::vector<const IndirectSVFGEdge *> footprint;
             unsigned numSCCs = SCC::detectSCCs(this, this->svfg, o, osStartingNodes, partOf, footprint);
 
             // 2. Skip any further processing of a footprint we have seen before.
+            //    Reliances are copied from the owner once all workers are done,
+            //    as the owner may still be working on them.
             {
-                std::lock_guard<std::mutex> guard(footprintOwnerMutex);
+                const size_t h = std::hash<std::vector<const IndirectSVFGEdge *>>()(footprint);
+                FootprintShard &shard = footprintShards[h % footprintShards.size()];
+                std::lock_guard<std::mutex> guard(shard.mutex);
                 const Map<std::vector<const IndirectSVFGEdge *>, NodeID>::const_iterator canonOwner
-                    = footprintOwner.find(footprint);
-                if (canonOwner == footprintOwner.end())
+                    = shard.footprintOwner.find(footprint);
+                if (canonOwner == shard.footprintOwner.end())
                 {
-                    this->equivalentObject[o] = o;
-                    footprintOwner[footprint] = o;
+                    canonicalObject[oi] = o;
+                    shard.footprintOwner[footprint] = o;
                 }
                 else
                 {
-                    this->equivalentObject[o] = canonOwner->second;
-                    // Same version and stmt reliance as the canonical. During solving we cannot just reuse
-                    // the canonical object's reliance because it may change due to on-the-fly call graph
-                    // construction. Something like copy-on-write could be good... probably negligible.
-                    this->versionReliance.at(o) = this->versionReliance.at(canonOwner->second);
-                    this->stmtReliance.at(o) = this->stmtReliance.at(canonOwner->second);
+                    canonicalObject[oi] = canonOwner->second;
                     continue;
                 }
             }
@@ -414,11 +423,25 @@ void VersionedFlowSensitive::meldLabel(void)
     };
 
     std::vector<std::thread> workers;
-    for (unsigned i = 0; i < Options::VersioningThreads(); ++i) workers.push_back(std::thread(meldVersionWorker, i));
+    for (unsigned i = 0; i < numThreads; ++i) workers.push_back(std::thread(meldVersionWorker, i));
     for (std::thread &worker : workers) worker.join();
 
     delete[] versionMutexes;
 
+    for (size_t oi = 0; oi < prelabeledObjects.size(); ++oi)
+    {
+        const NodeID o = prelabeledObjects[oi];
+        const NodeID canon = canonicalObject[oi];
+        equivalentObject[o] = canon;
+        if (canon == o) continue;
+
+        // Same version and stmt reliance as the canonical. During solving we cannot just reuse
+        // the canonical object's reliance because it may change due to on-the-fly call graph
+        // construction. Something like copy-on-write could be good... probably negligible.
+        versionReliance.at(o) = versionReliance.at(canon);
+        stmtReliance.at(o) = stmtReliance.at(canon);
+    }
+
     double end = stat->getClk(true);
     meldLabelingTime = (end - start) / TIMEINTERVAL;
 }
@@ -644,6 +667,73 @@ void VersionedFlowSensitive::updateConnectedNodes(const SVFGEdgeSetTy& newEdges)
     }
 }
 
+/*!
+ * Indirect edges are gone, so an unconverged node only reaches the loads of
+ * the objects it may write through versions. Objects are compared by their
+ * base object to cover field-insensitive loads.
+ */
+void VersionedFlowSensitive::collectUnconvergedNodes(NodeBS& unconverged)
+{
+    FlowSensitive::collectUnconvergedNodes(unconverged);
+
+    std::vector<const LoadSVFGNode*> loads;
+    for (SVFG::const_iterator it = svfg->begin(), eit = svfg->end(); it != eit; ++it)
+    {
+        if (const LoadSVFGNode* load = SVFUtil::dyn_cast<LoadSVFGNode>(it->second))
+            loads.push_back(load);
+    }
+
+    NodeBS scanned;
+    NodeBS dirtyObjs;
+    while (true)
+    {
+        NodeBS fresh = unconverged;
+        fresh.intersectWithComplement(scanned);
+        scanned |= unconverged;
+
+        bool newObjs = false;
+        for (NodeID n : fresh)
+        {
+            const SVFGNode* node = svfg->getSVFGNode(n);
+            NodeBS objs;
+            if (const StoreSVFGNode* store = SVFUtil::dyn_cast<StoreSVFGNode>(node))
+                objs = ander->getPts(store->getPAGDstNodeID()).toNodeBS();
+            else if (const DummyVersionPropSVFGNode* dvp = SVFUtil::dyn_cast<DummyVersionPropSVFGNode>(node))
+                objs.set(dvp->getObject());
+            else if (const MRSVFGNode* mr = SVFUtil::dyn_cast<MRSVFGNode>(node))
+                objs = mr->getPointsTo();
+
+            for (NodeID o : objs)
+            {
+                if (dirtyObjs.test_and_set(pag->getBaseObjVar(o)))
+                    newObjs = true;
+            }
+        }
+        if (!newObjs)
+            break;
+
+        bool newNodes = false;
+        for (const LoadSVFGNode* load : loads)
+        {
+            if (unconverged.test(load->getId()))
+                continue;
+            for (NodeID o : ander->getPts(load->getPAGSrcNodeID()))
+            {
+                if (dirtyObjs.test(pag->getBaseObjVar(o)))
+                {
+                    unconverged.set(load->getId());
+                    newNodes = true;
+                    break;
+                }
+            }
+        }
+        if (!newNodes)
+            break;
+
+        addReachableNodes(unconverged);
+    }
+}
+
 bool VersionedFlowSensitive::processLoad(const LoadSVFGNode* load)
 {
     double start = stat->getClk();
@@ -122,6 +122,11 @@ void VersionedFlowSensitiveStat::performStat()
 
     PTNumStatMap["StrongUpdates"] = vfspta->svfgHasSU.count();
 
+    PTNumStatMap["BudgetExhausted"] = vfspta->budgetExhausted;
+    PTNumStatMap["FallbackPtrs"]    = vfspta->numOfFallbackPtrs;
+    timeStatMap["RefinedPtrPercent"] = vfspta->numOfRefinablePtrs == 0 ? 100.0
+                                       : 100.0 * (vfspta->numOfRefinablePtrs - vfspta->numOfFallbackPtrs) / vfspta->numOfRefinablePtrs;
+
     PTNumStatMap["MaxPtsSize"]        = _MaxPtsSize;
     PTNumStatMap["MaxTopLvlPtsSize"]  = _MaxTopLvlPtsSize;
     PTNumStatMap["MaxVersionPtsSize"] = _MaxVersionPtsSize;
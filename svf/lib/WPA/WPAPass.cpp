@@ -39,6 +39,7 @@
 #include "WPA/WPAPass.h"
 #include "WPA/Andersen.h"
 #include "WPA/AndersenPWC.h"
+#include "WPA/AndersenLCD.h"
 #include "WPA/FlowSensitive.h"
 #include "WPA/VersionedFlowSensitive.h"
 #include "WPA/TypeAnalysis.h"
@@ -53,6 +54,9 @@ char WPAPass::ID = 0;
  */
 WPAPass::~WPAPass()
 {
+    // The SVFG refers to the pointer analysis it was built from.
+    svfgBuilder.reset();
+
     PTAVector::const_iterator it = ptaVector.begin();
     PTAVector::const_iterator eit = ptaVector.end();
     for (; it != eit; ++it)
@@ -94,6 +98,12 @@ void WPAPass::runPointerAnalysis(SVFIR* pag, u32_t kind)
     case PointerAnalysis::AndersenSFR_WPA:
         _pta = new AndersenSFR(pag);
         break;
+    case PointerAnalysis::AndersenLCD_WPA:
+        _pta = new AndersenLCD(pag);
+        break;
+    case PointerAnalysis::AndersenHCD_WPA:
+        _pta = new AndersenHCD(pag);
+        break;
     case PointerAnalysis::AndersenWaveDiff_WPA:
         _pta = new AndersenWaveDiff(pag);
         break;
@@ -118,12 +128,15 @@ void WPAPass::runPointerAnalysis(SVFIR* pag, u32_t kind)
     _pta->analyze();
     if (Options::AnderSVFG())
     {
-        SVFGBuilder memSSA(true);
+        std::unique_ptr<SVFGBuilder> memSSA(new SVFGBuilder(true));
         assert(SVFUtil::isa<AndersenBase>(_pta) && "supports only andersen/steensgaard for pre-computed SVFG");
-        SVFG *svfg = memSSA.buildFullSVFG((BVDataPTAImpl*)_pta);
+        SVFG *svfg = memSSA->buildFullSVFG((BVDataPTAImpl*)_pta);
         /// support mod-ref queries only for -ander
         if (Options::PASelected(PointerAnalysis::AndersenWaveDiff_WPA))
+        {
             _svfg = svfg;
+            svfgBuilder = std::move(memSSA);
+        }
     }
 
     if (Options::PrintAliases())